@@ -12,10 +12,10 @@ public:
                 if(j > i+1 && nums[j] == nums[j-1]) continue;
                 int left=j+1;
                 int right=n-1;
-                int remainingTarget=target-nums[i]-nums[j];
+                long long remainingTarget=(long long)target-nums[i]-nums[j];
                 while(left<right)
                 {
-                    int sum=nums[left]+nums[right];
+                    long long sum=(long long)nums[left]+nums[right];
                     if(sum==remainingTarget)
                     {
                         //found quadruplet
@@ -0,0 +1,385 @@
+#include<immintrin.h>
+
+//all unique k-tuples , stored back to back in one flat buffer : tuple t is flat[t*k .. t*k+k)
+struct KSumResult {
+    int k=0;
+    vector<int> flat;
+    size_t count() const
+    {
+        return k ? flat.size()/k : 0;
+    }
+    const int* tuple(size_t t) const
+    {
+        return flat.data()+t*k;
+    }
+};
+
+//one engine for 2Sum / 3Sum / 4Sum / kSum on a sorted array
+//fix (k-2) elements , two pointers for the last two , skip equal values at every level
+//-> every tuple comes out exactly once , no set / dedup pass afterwards
+//the outermost fixed index is split across threads with work stealing ,
+//since tuples starting at small values have much longer inner loops
+class KSum {
+public:
+    //fewer outer candidates than this -> one thread : creating and joining the threads would
+    //cost more than the search itself (leetcode sizes are n<=3000)
+    static const int PARALLEL_MIN_TASKS=4096;
+
+    //fast = bound pruning at every fixed level + SIMD skipping in the two-pointer loop
+    static KSumResult solve(vector<int>& nums,int k,long long target,int threads,bool fast=false)
+    {
+        sort(nums.begin(),nums.end());
+        KSumResult res;
+        res.k=k;
+        int n=nums.size();
+        if(k<2 || n<k)
+        {
+            return res;
+        }
+        if(k==2)
+        {
+            //nothing to fix , a single two-pointer pass
+            vector<int> prefix(k);
+            if(fast)
+            {
+                fastSearch(nums,{},0,2,target,prefix,0,res.flat);
+            }
+            else
+            {
+                search(nums,0,2,target,prefix,0,res.flat);
+            }
+            return res;
+        }
+        //tasks are the outer indices 0..n-k , each worker starts with an even slice
+        int tasks=n-k+1;
+        threads= tasks<PARALLEL_MIN_TASKS ? 1 : max(1,min(threads,tasks));
+        vector<Worker> workers(threads);
+        for(int w=0;w<threads;w++)
+        {
+            workers[w].begin=(long long)tasks*w/threads;
+            workers[w].end=(long long)tasks*(w+1)/threads;
+        }
+        //prefix sums for the min / max bounds of fast mode : pre[i] = nums[0]+..+nums[i-1]
+        vector<long long> pre;
+        if(fast)
+        {
+            pre.assign(n+1,0);
+            for(int i=0;i<n;i++)
+            {
+                pre[i+1]=pre[i]+nums[i];
+            }
+        }
+        //where the tuples of task i landed : worker buffer + [from,to)
+        vector<Segment> segments(tasks);
+        auto run=[&](int self)
+        {
+            Worker& me=workers[self];
+            vector<int> prefix(k);
+            int i;
+            while(popOwn(me,i) || stealAndPop(workers,self,i))
+            {
+                Segment& seg=segments[i];
+                seg.worker=self;
+                seg.from=me.out.size();
+                if(i==0 || nums[i]!=nums[i-1])
+                {
+                    prefix[0]=nums[i];
+                    if(!fast)
+                    {
+                        search(nums,i+1,k-1,target-nums[i],prefix,1,me.out);
+                    }
+                    else if(reachable(pre,n,i,k,target))
+                    {
+                        fastSearch(nums,pre,i+1,k-1,target-nums[i],prefix,1,me.out);
+                    }
+                }
+                seg.to=me.out.size();
+            }
+        };
+        vector<thread> pool;
+        for(int w=1;w<threads;w++)
+        {
+            pool.emplace_back(run,w);
+        }
+        run(0);
+        for(auto& t:pool)
+        {
+            t.join();
+        }
+        //stitch in outer index order , same order the serial loops produce
+        size_t total=0;
+        for(auto& w:workers)
+        {
+            total+=w.out.size();
+        }
+        res.flat.reserve(total);
+        for(auto& seg:segments)
+        {
+            auto& out=workers[seg.worker].out;
+            res.flat.insert(res.flat.end(),out.begin()+seg.from,out.begin()+seg.to);
+        }
+        return res;
+    }
+private:
+    struct Worker {
+        mutex m;
+        int begin=0;
+        int end=0;
+        vector<int> out;
+    };
+    struct Segment {
+        int worker=0;
+        size_t from=0;
+        size_t to=0;
+    };
+    static bool popOwn(Worker& w,int& i)
+    {
+        lock_guard<mutex> lock(w.m);
+        if(w.begin<w.end)
+        {
+            i=w.begin++;
+            return true;
+        }
+        return false;
+    }
+    //take the back half of someone else's range , then run its first task
+    static bool stealAndPop(vector<Worker>& workers,int self,int& i)
+    {
+        int threads=workers.size();
+        for(int d=1;d<threads;d++)
+        {
+            Worker& victim=workers[(self+d)%threads];
+            Worker& me=workers[self];
+            scoped_lock lock(victim.m,me.m);
+            int left=victim.end-victim.begin;
+            if(left<=0)
+            {
+                continue;
+            }
+            int half=(left+1)/2;
+            me.begin=victim.end-half;
+            me.end=victim.end;
+            victim.end=me.begin;
+            i=me.begin++;
+            return true;
+        }
+        return false;
+    }
+    //k values from nums[start..] summing to target , prefix[0..depth) already fixed
+    static void search(const vector<int>& nums,int start,int k,long long target,vector<int>& prefix,int depth,vector<int>& out)
+    {
+        int n=nums.size();
+        if(k==2)
+        {
+            int left=start;
+            int right=n-1;
+            while(left<right)
+            {
+                long long sum=(long long)nums[left]+nums[right];
+                if(sum==target)
+                {
+                    out.insert(out.end(),prefix.begin(),prefix.begin()+depth);
+                    out.push_back(nums[left]);
+                    out.push_back(nums[right]);
+                    left++;
+                    right--;
+                    while(left<right && nums[left]==nums[left-1])
+                    {
+                        left++;
+                    }
+                    while(left<right && nums[right]==nums[right+1])
+                    {
+                        right--;
+                    }
+                }
+                else if(sum<target)
+                {
+                    left++;
+                }
+                else
+                {
+                    right--;
+                }
+            }
+            return;
+        }
+        for(int j=start;j<=n-k;j++)
+        {
+            if(j>start && nums[j]==nums[j-1])
+            {
+                continue;
+            }
+            prefix[depth]=nums[j];
+            search(nums,j+1,k-1,target-nums[j],prefix,depth+1,out);
+        }
+    }
+    //can k values starting with nums[j] (the rest from after j) still make target ?
+    //smallest choice : nums[j..j+k) , largest : nums[j] + the last k-1
+    static bool reachable(const vector<long long>& pre,int n,int j,int k,long long target)
+    {
+        long long smallest=pre[j+k]-pre[j];
+        long long largest=(pre[j+1]-pre[j])+(pre[n]-pre[n-k+1]);
+        return smallest<=target && target<=largest;
+    }
+    static void fastSearch(const vector<int>& nums,const vector<long long>& pre,int start,int k,long long target,vector<int>& prefix,int depth,vector<int>& out)
+    {
+        int n=nums.size();
+        const int* a=nums.data();
+        if(k==2)
+        {
+            int left=start;
+            int right=n-1;
+            while(left<right)
+            {
+                long long sum=(long long)a[left]+a[right];
+                if(sum<target)
+                {
+                    //jump over every a[left] that is still too small for this a[right]
+                    left=skipBelow(a,left+1,right,target-a[right]);
+                }
+                else if(sum>target)
+                {
+                    right=skipAbove(a,left,right-1,target-a[left]);
+                }
+                else
+                {
+                    out.insert(out.end(),prefix.begin(),prefix.begin()+depth);
+                    out.push_back(a[left]);
+                    out.push_back(a[right]);
+                    //next different values on both sides
+                    left=skipBelow(a,left+1,right,(long long)a[left]+1);
+                    right=skipAbove(a,left,right-1,(long long)a[right]-1);
+                }
+            }
+            return;
+        }
+        for(int j=start;j<=n-k;j++)
+        {
+            if(j>start && nums[j]==nums[j-1])
+            {
+                continue;
+            }
+            long long smallest=pre[j+k]-pre[j];
+            if(smallest>target)
+            {
+                //j only grows from here , so does the smallest sum
+                break;
+            }
+            if(nums[j]+(pre[n]-pre[n-k+1])<target)
+            {
+                continue;
+            }
+            prefix[depth]=nums[j];
+            fastSearch(nums,pre,j+1,k-1,target-nums[j],prefix,depth+1,out);
+        }
+    }
+    //first index in [from,to) with a[i] >= bound , to if there is none (a is sorted)
+    static int skipBelow(const int* a,int from,int to,long long bound)
+    {
+        if(bound>INT_MAX)
+        {
+            return to;
+        }
+        if(bound<=INT_MIN)
+        {
+            return from;
+        }
+        return hasAvx2 ? skipBelowAvx2(a,from,to,(int)bound) : skipBelowScalar(a,from,to,(int)bound);
+    }
+    //last index in [from,to] with a[i] <= bound , from if there is none
+    static int skipAbove(const int* a,int from,int to,long long bound)
+    {
+        if(bound>=INT_MAX)
+        {
+            return to;
+        }
+        if(bound<INT_MIN)
+        {
+            return from;
+        }
+        return hasAvx2 ? skipAboveAvx2(a,from,to,(int)bound) : skipAboveScalar(a,from,to,(int)bound);
+    }
+    static int skipBelowScalar(const int* a,int from,int to,int bound)
+    {
+        while(from<to && a[from]<bound)
+        {
+            from++;
+        }
+        return from;
+    }
+    static int skipAboveScalar(const int* a,int from,int to,int bound)
+    {
+        while(to>from && a[to]>bound)
+        {
+            to--;
+        }
+        return to;
+    }
+    //8 candidates per compare , the sorted order makes the hits a prefix / suffix of the block
+    __attribute__((target("avx2")))
+    static int skipBelowAvx2(const int* a,int from,int to,int bound)
+    {
+        __m256i b=_mm256_set1_epi32(bound);
+        while(from+8<=to)
+        {
+            __m256i v=_mm256_loadu_si256((const __m256i*)(a+from));
+            unsigned below=_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(b,v)));
+            if(below!=0xFF)
+            {
+                return from+__builtin_ctz(~below);
+            }
+            from+=8;
+        }
+        return skipBelowScalar(a,from,to,bound);
+    }
+    __attribute__((target("avx2")))
+    static int skipAboveAvx2(const int* a,int from,int to,int bound)
+    {
+        __m256i b=_mm256_set1_epi32(bound);
+        while(to-7>from)
+        {
+            __m256i v=_mm256_loadu_si256((const __m256i*)(a+to-7));
+            unsigned above=_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v,b)));
+            if(above!=0xFF)
+            {
+                //highest lane that is <= bound
+                return to-7+31-__builtin_clz(~above&0xFF);
+            }
+            to-=8;
+        }
+        return skipAboveScalar(a,from,to,bound);
+    }
+    static inline const bool hasAvx2=[]
+    {
+        __builtin_cpu_init();
+        return (bool)__builtin_cpu_supports("avx2");
+    }();
+};
+
+class Solution {
+public:
+    vector<vector<int>> threeSum(vector<int>& nums) {
+        return toNested(KSum::solve(nums,3,0,thread::hardware_concurrency()));
+    }
+    vector<vector<int>> fourSum(vector<int>& nums, int target) {
+        return toNested(KSum::solve(nums,4,target,thread::hardware_concurrency()));
+    }
+    //fast mode : same answers , pruned + SIMD inner loop
+    vector<vector<int>> threeSumFast(vector<int>& nums) {
+        return toNested(KSum::solve(nums,3,0,thread::hardware_concurrency(),true));
+    }
+    vector<vector<int>> fourSumFast(vector<int>& nums, int target) {
+        return toNested(KSum::solve(nums,4,target,thread::hardware_concurrency(),true));
+    }
+    //only for callers that need the leetcode shape , the flat result is the fast one
+    vector<vector<int>> toNested(const KSumResult& res)
+    {
+        vector<vector<int>> ans;
+        ans.reserve(res.count());
+        for(size_t t=0;t<res.count();t++)
+        {
+            ans.emplace_back(res.tuple(t),res.tuple(t)+res.k);
+        }
+        return ans;
+    }
+};
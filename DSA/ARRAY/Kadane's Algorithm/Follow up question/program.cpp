@@ -1,7 +1,18 @@
+#include "../subarray.h"
+
 class Solution {
 public:
-    // Function to find maximum sum of subarrays and print the subarray having maximum sum
+    // Function to find maximum sum of subarrays
     int maxSubArray(vector<int>& nums) {
+        return maxSubArrayRange(nums).sum;
+    }
+
+    // Function to find the maximum sum subarray , bounds are returned instead of printed
+    // empty input -> SubArray{} (sum 0 , start = end = -1) , same as KadaneAccumulator
+    SubArray maxSubArrayRange(const vector<int>& nums) {
+        if (nums.empty()) {
+            return {};
+        }
         
         // maximum sum
         long long maxi = LLONG_MIN; 
@@ -40,14 +51,16 @@ public:
             }
         }
         
-        // Printing the subarray
+        // Return the maximum subarray and its sum
+        return {maxi, ansStart, ansEnd};
+    }
+
+    // Printing the subarray , kept out of the hot function
+    void printSubArray(const vector<int>& nums, const SubArray& best) {
         cout << "The subarray is: [";
-        for (int i = ansStart; i <= ansEnd; i++) {
+        for (long long i = best.start; i <= best.end; i++) {
             cout << nums[i] << " ";
         }
         cout << "]" << endl;
-        
-        // Return the maximum subarray sum found
-        return maxi;
     }
 };
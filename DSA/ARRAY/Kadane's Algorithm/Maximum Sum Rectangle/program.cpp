@@ -0,0 +1,215 @@
+#include<immintrin.h>
+
+//maximum sum submatrix rows top..bottom , columns left..right (inclusive)
+struct Rectangle {
+    long long sum=LLONG_MIN;
+    int top=-1;
+    int left=-1;
+    int bottom=-1;
+    int right=-1;
+};
+
+//8 independent Kadane runs side by side , one per lane
+//at step t lane l sees src[t*stride+l] - bias[t*biasStride] (no bias if bias is null)
+//best[l] = maximum subarray sum of lane l's sequence
+static void kadaneLanesScalar(const long long* src,size_t stride,const long long* bias,size_t biasStride,int len,int lanes,long long* best)
+{
+    for(int l=0;l<lanes;l++)
+    {
+        long long cur=0;
+        long long top=LLONG_MIN;
+        for(int t=0;t<len;t++)
+        {
+            long long x=src[t*stride+l]-(bias ? bias[t*biasStride] : 0);
+            cur=x+max(cur,0LL);
+            top=max(top,cur);
+        }
+        best[l]=top;
+    }
+}
+
+__attribute__((target("avx2")))
+static inline __m256i max64(__m256i a,__m256i b)
+{
+    return _mm256_blendv_epi8(b,a,_mm256_cmpgt_epi64(a,b));
+}
+
+//same thing , 8 lanes in two ymm registers of int64
+__attribute__((target("avx2")))
+static void kadaneLanesAvx2(const long long* src,size_t stride,const long long* bias,size_t biasStride,int len,long long* best)
+{
+    __m256i zero=_mm256_setzero_si256();
+    __m256i cur0=zero,cur1=zero;
+    __m256i best0=_mm256_set1_epi64x(LLONG_MIN),best1=best0;
+    for(int t=0;t<len;t++)
+    {
+        const long long* row=src+t*stride;
+        __m256i x0=_mm256_loadu_si256((const __m256i*)row);
+        __m256i x1=_mm256_loadu_si256((const __m256i*)(row+4));
+        if(bias)
+        {
+            __m256i b=_mm256_set1_epi64x(bias[t*biasStride]);
+            x0=_mm256_sub_epi64(x0,b);
+            x1=_mm256_sub_epi64(x1,b);
+        }
+        //cur = x + max(cur , 0) ; best = max(best , cur)
+        cur0=_mm256_add_epi64(x0,max64(cur0,zero));
+        cur1=_mm256_add_epi64(x1,max64(cur1,zero));
+        best0=max64(best0,cur0);
+        best1=max64(best1,cur1);
+    }
+    _mm256_storeu_si256((__m256i*)best,best0);
+    _mm256_storeu_si256((__m256i*)(best+4),best1);
+}
+
+static const bool hasAvx2=[]
+{
+    __builtin_cpu_init();
+    return (bool)__builtin_cpu_supports("avx2");
+}();
+
+static void kadaneLanes(const long long* src,size_t stride,const long long* bias,size_t biasStride,int len,int lanes,long long* best)
+{
+    if(lanes==8 && hasAvx2)
+    {
+        kadaneLanesAvx2(src,stride,bias,biasStride,len,best);
+    }
+    else
+    {
+        kadaneLanesScalar(src,stride,bias,biasStride,len,lanes,best);
+    }
+}
+
+class Solution {
+public:
+    //maxSubArray of every row , 8 rows at a time (one row per lane)
+    vector<long long> maxSubArrayRows(const vector<vector<int>>& matrix)
+    {
+        int rows=matrix.size();
+        int cols= rows ? matrix[0].size() : 0;
+        vector<long long> ans(rows,LLONG_MIN);
+        if(cols==0)
+        {
+            return ans;
+        }
+        //8 rows transposed into a cols x 8 tile , so column c of the 8 rows is one contiguous load
+        vector<long long> tile((size_t)cols*8,0);
+        long long best[8];
+        for(int r0=0;r0<rows;r0+=8)
+        {
+            int lanes=min(8,rows-r0);
+            const int* row[8];
+            for(int l=0;l<8;l++)
+            {
+                row[l]=matrix[r0+min(l,lanes-1)].data();
+            }
+            //8 sequential read streams , one sequential write stream
+            long long* out=tile.data();
+            for(int c=0;c<cols;c++,out+=8)
+            {
+                for(int l=0;l<8;l++)
+                {
+                    out[l]=row[l][c];
+                }
+            }
+            kadaneLanes(tile.data(),8,nullptr,0,cols,8,best);
+            for(int l=0;l<lanes;l++)
+            {
+                ans[r0+l]=best[l];
+            }
+        }
+        return ans;
+    }
+
+    //maximum sum rectangle , O(cols^2 * rows)
+    //every column pair (a,b) squashes to one column sum per row -> Kadane down the rows
+    //with row prefix sums P , that value is P[r][b+1]-P[r][a] : for a fixed a , 8 consecutive b's
+    //are 8 contiguous P values minus one broadcast -> exactly the lane kernel
+    Rectangle maxSumRectangle(const vector<vector<int>>& matrix,int threads)
+    {
+        int rows=matrix.size();
+        int cols= rows ? matrix[0].size() : 0;
+        if(cols==0)
+        {
+            return {};
+        }
+        size_t stride=cols+1;
+        vector<long long> pre((size_t)rows*stride,0);
+        for(int r=0;r<rows;r++)
+        {
+            for(int c=0;c<cols;c++)
+            {
+                pre[r*stride+c+1]=pre[r*stride+c]+matrix[r][c];
+            }
+        }
+        //left columns handed out one by one : small a has many more pairs than large a
+        atomic<int> nextLeft(0);
+        threads=max(1,min(threads,cols));
+        vector<Rectangle> found(threads);
+        auto work=[&](int self)
+        {
+            Rectangle& mine=found[self];
+            long long best[8];
+            int a;
+            while((a=nextLeft++)<cols)
+            {
+                for(int b0=a;b0<cols;b0+=8)
+                {
+                    int lanes=min(8,cols-b0);
+                    kadaneLanes(pre.data()+b0+1,stride,pre.data()+a,stride,rows,lanes,best);
+                    for(int l=0;l<lanes;l++)
+                    {
+                        if(best[l]>mine.sum)
+                        {
+                            mine.sum=best[l];
+                            mine.left=a;
+                            mine.right=b0+l;
+                        }
+                    }
+                }
+            }
+        };
+        vector<thread> pool;
+        for(int t=1;t<threads;t++)
+        {
+            pool.emplace_back(work,t);
+        }
+        work(0);
+        for(auto& th:pool)
+        {
+            th.join();
+        }
+        Rectangle ans;
+        for(auto& rect:found)
+        {
+            if(rect.sum>ans.sum)
+            {
+                ans=rect;
+            }
+        }
+        //only the winning column pair needs its rows , one scalar Kadane with bounds
+        long long cur=0;
+        int start=0;
+        long long top=LLONG_MIN;
+        for(int r=0;r<rows;r++)
+        {
+            long long x=pre[r*stride+ans.right+1]-pre[r*stride+ans.left];
+            if(cur<=0)
+            {
+                cur=x;
+                start=r;
+            }
+            else
+            {
+                cur+=x;
+            }
+            if(cur>top)
+            {
+                top=cur;
+                ans.top=start;
+                ans.bottom=r;
+            }
+        }
+        return ans;
+    }
+};
@@ -1,3 +1,182 @@
+#include "subarray.h"
+
+//everything needed to glue a piece of the array to its neighbours
+//total , best prefix , best suffix , best anywhere -> combining two pieces is associative
+struct KadaneSummary {
+    long long count=0;
+    long long total=0;
+    SubArray prefix;
+    SubArray suffix;
+    SubArray best;
+};
+
+//online Kadane : feed chunks as they arrive , ask for the answer at any time
+//the Kadane running sum is exactly the best suffix , so the summary comes for free
+class KadaneAccumulator {
+public:
+    //startPos = global index of the first element this accumulator will see
+    explicit KadaneAccumulator(long long startPos=0) : pos(startPos) {}
+    void feed(const int* data,size_t len)
+    {
+        size_t i=0;
+        if(s.count==0 && len>0)
+        {
+            SubArray first{data[0],pos,pos};
+            s.total=data[0];
+            s.prefix=s.suffix=s.best=first;
+            s.count=1;
+            pos++;
+            i=1;
+        }
+        size_t begin=i;
+        //locals keep the hot loop in registers
+        long long total=s.total;
+        SubArray prefix=s.prefix;
+        SubArray suffix=s.suffix;
+        SubArray best=s.best;
+        for(;i<len;i++,pos++)
+        {
+            long long x=data[i];
+            total+=x;
+            if(total>prefix.sum)
+            {
+                prefix.sum=total;
+                prefix.end=pos;
+            }
+            if(suffix.sum<0)
+            {
+                suffix={x,pos,pos};
+            }
+            else
+            {
+                suffix.sum+=x;
+                suffix.end=pos;
+            }
+            if(suffix.sum>best.sum)
+            {
+                best=suffix;
+            }
+        }
+        s.count+=len-begin;
+        s.total=total;
+        s.prefix=prefix;
+        s.suffix=suffix;
+        s.best=best;
+    }
+    void feed(const vector<int>& chunk)
+    {
+        feed(chunk.data(),chunk.size());
+    }
+    SubArray result() const
+    {
+        return s.best;
+    }
+    KadaneSummary summary() const
+    {
+        return s;
+    }
+    //l must be the piece right before r
+    static KadaneSummary combine(const KadaneSummary& l,const KadaneSummary& r)
+    {
+        if(l.count==0) return r;
+        if(r.count==0) return l;
+        KadaneSummary c;
+        c.count=l.count+r.count;
+        c.total=l.total+r.total;
+        c.prefix=l.prefix;
+        if(l.total+r.prefix.sum>c.prefix.sum)
+        {
+            c.prefix={l.total+r.prefix.sum,l.prefix.start,r.prefix.end};
+        }
+        c.suffix=r.suffix;
+        if(l.suffix.sum+r.total>c.suffix.sum)
+        {
+            c.suffix={l.suffix.sum+r.total,l.suffix.start,r.suffix.end};
+        }
+        c.best=l.best;
+        if(r.best.sum>c.best.sum)
+        {
+            c.best=r.best;
+        }
+        //best subarray crossing the border
+        if(l.suffix.sum+r.prefix.sum>c.best.sum)
+        {
+            c.best={l.suffix.sum+r.prefix.sum,l.suffix.start,r.prefix.end};
+        }
+        return c;
+    }
+private:
+    KadaneSummary s;
+    long long pos;
+};
+
+//sliding-window Kadane : best subarray inside the last `window` values of a stream
+//combine is associative , so the window is a queue of one-value summaries kept as two stacks :
+//  back  : newest values , plus the summary of all of them (extended on every push)
+//  front : oldest values , front[i] = summary of value i up to the newest value of the front
+//          stack , so front.back() covers the whole front stack
+//when front runs empty the back stack is flipped into it -> push is amortized O(1)
+class SlidingKadane {
+public:
+    explicit SlidingKadane(size_t window,long long startPos=0) : window(window),pos(startPos) {}
+    void push(int x)
+    {
+        KadaneSummary one;
+        one.count=1;
+        one.total=x;
+        one.prefix=one.suffix=one.best={x,pos,pos};
+        pos++;
+        back.push_back(one);
+        backAll=KadaneAccumulator::combine(backAll,one);
+        if(size()>window)
+        {
+            pop();
+        }
+    }
+    void feed(const int* data,size_t len)
+    {
+        for(size_t i=0;i<len;i++)
+        {
+            push(data[i]);
+        }
+    }
+    size_t size() const
+    {
+        return front.size()+back.size();
+    }
+    //best subarray of the current window , global indices ; SubArray{} while empty
+    SubArray result() const
+    {
+        if(front.empty())
+        {
+            return backAll.best;
+        }
+        return KadaneAccumulator::combine(front.back(),backAll).best;
+    }
+private:
+    size_t window;
+    long long pos;
+    vector<KadaneSummary> front;
+    vector<KadaneSummary> back;
+    KadaneSummary backAll;
+
+    void pop()
+    {
+        if(front.empty())
+        {
+            //newest first , so every entry covers itself and everything newer in the stack
+            KadaneSummary all;
+            for(size_t i=back.size();i-->0;)
+            {
+                all=KadaneAccumulator::combine(back[i],all);
+                front.push_back(all);
+            }
+            back.clear();
+            backAll=KadaneSummary();
+        }
+        front.pop_back();
+    }
+};
 
 class Solution {
 public:
@@ -19,4 +198,42 @@ public:
         
         
     }
+    //parallel mode : one accumulator per chunk , then fold the chunk summaries in order
+    //a chunk is never smaller than PARALLEL_MIN_CHUNK : Kadane does ~1 ns per element ,
+    //a thread costs tens of microseconds to start and join
+    static const long long PARALLEL_MIN_CHUNK=1<<16;
+    SubArray maxSubArrayParallel(const vector<int>& nums,int threads)
+    {
+        long long n=nums.size();
+        threads=max(1,(int)min<long long>(threads,n/PARALLEL_MIN_CHUNK));
+        if(threads==1)
+        {
+            KadaneAccumulator acc;
+            acc.feed(nums);
+            return acc.result();
+        }
+        vector<KadaneSummary> parts(threads);
+        vector<thread> pool;
+        for(int t=0;t<threads;t++)
+        {
+            pool.emplace_back([&,t]
+            {
+                long long from=n*t/threads;
+                long long to=n*(t+1)/threads;
+                KadaneAccumulator acc(from);
+                acc.feed(nums.data()+from,to-from);
+                parts[t]=acc.summary();
+            });
+        }
+        for(auto& th:pool)
+        {
+            th.join();
+        }
+        KadaneSummary all;
+        for(auto& part:parts)
+        {
+            all=KadaneAccumulator::combine(all,part);
+        }
+        return all.best;
+    }
 };
@@ -0,0 +1,9 @@
+//maximum sum subarray nums[start..end] (inclusive) , shared by Kadane's Algorithm and its follow up
+//empty input -> the defaults : sum 0 , start = end = -1 (every producer returns exactly this)
+#pragma once
+
+struct SubArray {
+    long long sum=0;
+    long long start=-1;
+    long long end=-1;
+};
@@ -0,0 +1,91 @@
+//flat row-major matrix + non-owning strided view
+//one allocation for the whole matrix , element (r,c) at data[r*stride+c]
+//a view can point at a sub-block (tile) of a bigger matrix without copying : only the stride differs
+#pragma once
+#include<cassert>
+#include<cstddef>
+#include<vector>
+
+template<class T>
+class MatrixView {
+public:
+    MatrixView() = default;
+    MatrixView(T* data,int rows,int cols,std::ptrdiff_t stride)
+        : ptr(data),nRows(rows),nCols(cols),rowStride(stride) {}
+    //a view of T converts to a view of const T
+    template<class U>
+    MatrixView(const MatrixView<U>& other)
+        : ptr(other.data()),nRows(other.rows()),nCols(other.cols()),rowStride(other.stride()) {}
+
+    T& operator()(int r,int c) const
+    {
+        return ptr[r*rowStride+c];
+    }
+    //pointer to the first element of row r , the row is contiguous
+    T* row(int r) const
+    {
+        return ptr+r*rowStride;
+    }
+    //rows [r0 , r0+rows) x cols [c0 , c0+cols) of this view , shares the memory
+    MatrixView sub(int r0,int c0,int rows,int cols) const
+    {
+        assert(r0>=0 && c0>=0 && r0+rows<=nRows && c0+cols<=nCols);
+        return MatrixView(ptr+r0*rowStride+c0,rows,cols,rowStride);
+    }
+    T* data() const { return ptr; }
+    int rows() const { return nRows; }
+    int cols() const { return nCols; }
+    std::ptrdiff_t stride() const { return rowStride; }
+    bool empty() const { return nRows==0 || nCols==0; }
+private:
+    T* ptr=nullptr;
+    int nRows=0;
+    int nCols=0;
+    std::ptrdiff_t rowStride=0;
+};
+
+template<class T>
+class Matrix {
+public:
+    Matrix() = default;
+    Matrix(int rows,int cols,const T& fill=T())
+        : buf((size_t)rows*cols,fill),nRows(rows),nCols(cols) {}
+    //from the vector<vector<T>> the leetcode signatures use (one copy , then never again)
+    explicit Matrix(const std::vector<std::vector<T>>& rowsIn)
+        : nRows(rowsIn.size()),nCols(rowsIn.empty() ? 0 : rowsIn[0].size())
+    {
+        buf.reserve((size_t)nRows*nCols);
+        for(auto& r:rowsIn)
+        {
+            buf.insert(buf.end(),r.begin(),r.end());
+        }
+    }
+
+    T& operator()(int r,int c) { return buf[(size_t)r*nCols+c]; }
+    const T& operator()(int r,int c) const { return buf[(size_t)r*nCols+c]; }
+    T* row(int r) { return buf.data()+(size_t)r*nCols; }
+    const T* row(int r) const { return buf.data()+(size_t)r*nCols; }
+
+    MatrixView<T> view() { return MatrixView<T>(buf.data(),nRows,nCols,nCols); }
+    MatrixView<const T> view() const { return MatrixView<const T>(buf.data(),nRows,nCols,nCols); }
+    operator MatrixView<T>() { return view(); }
+    operator MatrixView<const T>() const { return view(); }
+
+    std::vector<std::vector<T>> toNested() const
+    {
+        std::vector<std::vector<T>> out(nRows);
+        for(int r=0;r<nRows;r++)
+        {
+            out[r].assign(row(r),row(r)+nCols);
+        }
+        return out;
+    }
+    T* data() { return buf.data(); }
+    const T* data() const { return buf.data(); }
+    int rows() const { return nRows; }
+    int cols() const { return nCols; }
+private:
+    std::vector<T> buf;
+    int nRows=0;
+    int nCols=0;
+};
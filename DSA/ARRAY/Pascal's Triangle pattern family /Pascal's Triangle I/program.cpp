@@ -1,21 +1,18 @@
+#include "../binomial.h"
+
 class Solution {
 public:
-    int pascalTriangleI(int r, int c) {
+    //64-bit answer : exact for every row up to 68 (r-1 <= binomial::MAX_ROW_64) , asserted past that
+    //an int return would still wrap from C(34,17) on
+    uint64_t pascalTriangleI(int r, int c) {
         return nCr(r-1,c-1);
 
     }
 private:
-    int nCr(int r,int c)
+    //s*n/d in 64 bits (through 128 for the product) : no intermediate overflow
+    //the old int version overflowed the product s*n long before the answer itself
+    uint64_t nCr(int r,int c)
     {
-        int s=1;
-        int n=r;
-        int d=1;
-        for(int i=0;i<c;i++)
-        {
-            s=s*n/d;
-            n--;
-            d++;
-        }
-        return s;
+        return binomial::nCr<uint64_t>(r,c);
     }
 };
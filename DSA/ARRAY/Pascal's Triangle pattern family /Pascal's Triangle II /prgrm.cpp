@@ -1,29 +1,10 @@
+#include "../binomial.h"
+
 class Solution {
 public:
-    vector<int> pascalTriangleII(int r) {
-        vector<int> ans;
-        for(int i=1;i<=r;i++)
-        {
-            ans.push_back(nCr(r-1,i-1));
-        }
-        return ans;
-        
-
+    //whole row in O(r) : each entry from the one before it , C(n,k+1) = C(n,k)*(n-k)/(k+1)
+    //returned as 64-bit like the engine computes it : exact up to row 68 , asserted past that
+    vector<uint64_t> pascalTriangleII(int r) {
+        return binomial::row<uint64_t>(r-1);
     }
-private:
-    int nCr(int r,int c)
-    {
-        int s=1;
-        int n=r;
-        int d=1;
-        for(int i=0;i<c;i++)
-        {
-            s=s*n/d;
-            n--;
-            d++;
-        }
-        return s;
-    }
-
-    
 };
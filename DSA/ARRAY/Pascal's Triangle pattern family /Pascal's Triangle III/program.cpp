@@ -1,34 +1,50 @@
+#include "../../Matrix/matrix.h"
+#include "../binomial.h"
+
 class Solution {
 public:
-    vector<vector<int>> pascalTriangleIII(int n) {
-        vector<vector<int>> ans;
-        vector <int> temp;
-        int r=n;
-        for(int i=1 ;i<=r;i++)
+    //every row from the row above : one add per entry , O(n^2) in total
+    //64-bit entries : exact up to n = 68 rows (the last row that fits) , asserted past it
+    vector<vector<uint64_t>> pascalTriangleIII(int n) {
+        assert(n-1<=binomial::maxRow<uint64_t>());
+        vector<vector<uint64_t>> ans(n);
+        for(int i=0;i<n;i++)
         {
-            temp.clear();
-            for(int j=1;j<=i;j++)
+            ans[i].resize(i+1);
+            if(i==0)
             {
-                temp.push_back(nCr(i-1,j-1));
+                ans[i][0]=1;
+            }
+            else
+            {
+                binomial::nextRow(ans[i-1].data(),i,ans[i].data());
             }
-            ans.push_back(temp);
-
         }
         return ans;      
     }
-private:
-    int nCr(int r,int c)
-    {
-        int s=1;
-        int n=r;
-        int d=1;
-        for(int i=0;i<c;i++)
+    //flat version : n x n matrix , row i holds its i+1 entries , the rest stays 0
+    Matrix<uint64_t> pascalTriangleIIIFlat(int n) {
+        assert(n-1<=binomial::maxRow<uint64_t>());
+        Matrix<uint64_t> ans(n,n);
+        for(int i=0;i<n;i++)
+        {
+            if(i==0)
+            {
+                ans(0,0)=1;
+            }
+            else
+            {
+                binomial::nextRow(ans.row(i-1),i,ans.row(i));
+            }
+        }
+        return ans;
+    }
+    //the first n rows mod p (p prime , n<=p , p<2^31) , row i starts at i*(i+1)/2
+    vector<uint32_t> pascalTriangleMod(int n,uint32_t p,int threads) {
+        if(n==0)
         {
-            s=s*n/d;
-            n--;
-            d++;
+            return {};
         }
-        return s;
+        return binomial::ModTable(n-1,p).triangle(n,threads);
     }
-    
 };
@@ -0,0 +1,284 @@
+//binomial coefficients shared by the Pascal's Triangle family
+//exact : 64-bit (every C(n,r) with n<=67) and 128-bit (n<=131) , no intermediate overflow
+//mod p : factorial tables , O(1) per C(n,r) , large triangles built across threads
+//whole rows come from the previous row (one add per entry) -> O(n^2) for a triangle
+#pragma once
+#include<algorithm>
+#include<cassert>
+#include<cstdint>
+#include<thread>
+#include<type_traits>
+#include<utility>
+#include<vector>
+
+namespace binomial {
+
+using u128=unsigned __int128;
+
+//largest n whose whole row fits : C(67,33) < 2^64 < C(68,34) , C(131,65) < 2^128 < C(132,66)
+//signed / 32-bit : C(66,33) < 2^63 , C(34,17) < 2^32 , C(33,16) < 2^31
+static const int MAX_ROW_64=67;
+static const int MAX_ROW_128=131;
+static const int MAX_ROW_63=66;
+static const int MAX_ROW_32=34;
+static const int MAX_ROW_31=33;
+
+template<class T>
+constexpr int maxRow()
+{
+    static_assert(sizeof(T)>=4,"rows past 16 do not fit in 16 bits");
+    if(sizeof(T)>8)
+    {
+        return MAX_ROW_128;
+    }
+    if(sizeof(T)==8)
+    {
+        return std::is_signed<T>::value ? MAX_ROW_63 : MAX_ROW_64;
+    }
+    return std::is_signed<T>::value ? MAX_ROW_31 : MAX_ROW_32;
+}
+
+template<class T>
+T gcd(T a,T b)
+{
+    while(b)
+    {
+        T t=a%b;
+        a=b;
+        b=t;
+    }
+    return a;
+}
+
+//s*m/d when d divides s*m , without overflowing when the result fits
+//64-bit : the product goes through 128 bits
+//128-bit : cancel g=gcd(s,d) first , then d/g divides m and nothing exceeds the result
+template<class T>
+T mulDivExact(T s,T m,T d)
+{
+    if constexpr(sizeof(T)<=8)
+    {
+        return (T)((u128)s*m/d);
+    }
+    else
+    {
+        T g=gcd(s,d);
+        return (s/g)*(m/(d/g));
+    }
+}
+
+//C(n,r) exactly , T = uint64_t (n<=67) or u128 (n<=131)
+//C(n,i+1) = C(n,i)*(n-i)/(i+1) , always an exact division
+template<class T>
+T nCr(int n,int r)
+{
+    if(r<0 || r>n)
+    {
+        return 0;
+    }
+    //past the last row that fits the answer itself wraps
+    assert(n<=maxRow<T>());
+    r=std::min(r,n-r);
+    T s=1;
+    for(int i=0;i<r;i++)
+    {
+        s=mulDivExact<T>(s,n-i,i+1);
+    }
+    return s;
+}
+
+//row n alone in O(n) , same recurrence , the second half mirrors the first
+template<class T>
+std::vector<T> row(int n)
+{
+    assert(n<=maxRow<T>());
+    std::vector<T> ans(n+1);
+    ans[0]=1;
+    for(int i=0;i<n/2;i++)
+    {
+        ans[i+1]=mulDivExact<T>(ans[i],n-i,i+1);
+    }
+    for(int i=n/2+1;i<=n;i++)
+    {
+        ans[i]=ans[n-i];
+    }
+    return ans;
+}
+
+//row n written to out[0..n] from row n-1 in prev[0..n-1] , any T with + (int , long long , ...)
+template<class T>
+void nextRow(const T* prev,int n,T* out)
+{
+    assert(n<=maxRow<T>());
+    out[0]=1;
+    out[n]=1;
+    for(int k=1;k<n;k++)
+    {
+        out[k]=prev[k-1]+prev[k];
+    }
+}
+
+//row n of a triangle stored row after row : rows 0..n-1 take n*(n+1)/2 cells
+inline size_t rowOffset(int n)
+{
+    return (size_t)n*(n+1)/2;
+}
+
+//every C(n,r) with n<=rows-1 in one triangular array , then O(1) lookups
+template<class T>
+class Table {
+public:
+    explicit Table(int rows)
+        : nRows(rows),cells(rowOffset(rows))
+    {
+        assert(rows-1<=maxRow<T>());
+        for(int n=0;n<rows;n++)
+        {
+            if(n==0)
+            {
+                cells[0]=1;
+            }
+            else
+            {
+                nextRow(&cells[rowOffset(n-1)],n,&cells[rowOffset(n)]);
+            }
+        }
+    }
+    T operator()(int n,int r) const
+    {
+        return (r<0 || r>n) ? 0 : cells[rowOffset(n)+r];
+    }
+    const T* row(int n) const { return &cells[rowOffset(n)]; }
+    int rows() const { return nRows; }
+    //out[i] = C(queries[i].first , queries[i].second)
+    std::vector<T> query(const std::vector<std::pair<int,int>>& queries) const
+    {
+        std::vector<T> out(queries.size());
+        for(size_t i=0;i<queries.size();i++)
+        {
+            out[i]=(*this)(queries[i].first,queries[i].second);
+        }
+        return out;
+    }
+private:
+    int nRows;
+    std::vector<T> cells;
+};
+
+//C(n,r) mod p for n<=maxN , p prime and p>maxN (so every k! is invertible)
+//p < 2^31 so two residues add without wrapping
+//C(n,r) = n! * inv(r!) * inv((n-r)!)
+class ModTable {
+public:
+    ModTable(int maxN,uint32_t p)
+        : p(p),fact(maxN+1),invFact(maxN+1)
+    {
+        assert(maxN>=0 && (uint32_t)maxN<p && p<(1u<<31));
+        fact[0]=1;
+        for(int i=1;i<=maxN;i++)
+        {
+            fact[i]=(uint64_t)fact[i-1]*i%p;
+        }
+        //one Fermat inverse , the rest walk down : 1/(i-1)! = i/i!
+        invFact[maxN]=power(fact[maxN],p-2);
+        for(int i=maxN;i>0;i--)
+        {
+            invFact[i-1]=(uint64_t)invFact[i]*i%p;
+        }
+    }
+    uint32_t operator()(int n,int r) const
+    {
+        if(r<0 || r>n)
+        {
+            return 0;
+        }
+        return (uint64_t)fact[n]*invFact[r]%p*invFact[n-r]%p;
+    }
+    std::vector<uint32_t> query(const std::vector<std::pair<int,int>>& queries) const
+    {
+        std::vector<uint32_t> out(queries.size());
+        for(size_t i=0;i<queries.size();i++)
+        {
+            out[i]=(*this)(queries[i].first,queries[i].second);
+        }
+        return out;
+    }
+
+    //rows 0..rows-1 mod p , row after row (row n at rowOffset(n)) , rows<=maxN+1
+    //each thread gets a band of rows with about the same number of cells : the first row of a
+    //band comes straight from the factorials , the others from the row above (one add each)
+    std::vector<uint32_t> triangle(int rows,int threads) const
+    {
+        assert(rows<=(int)fact.size());
+        std::vector<uint32_t> cells(rowOffset(rows));
+        threads=std::max(1,std::min(threads,rows));
+        //band t = rows [bound[t] , bound[t+1]) , rowOffset(bound[t]) ~ t/threads of the cells
+        std::vector<int> bound(threads+1,rows);
+        bound[0]=0;
+        for(int t=1,n=0;t<threads;t++)
+        {
+            size_t want=cells.size()/threads*t;
+            while(n<rows && rowOffset(n)<want)
+            {
+                n++;
+            }
+            bound[t]=n;
+        }
+        auto work=[&](int t)
+        {
+            for(int n=bound[t];n<bound[t+1];n++)
+            {
+                uint32_t* out=&cells[rowOffset(n)];
+                if(n==bound[t])
+                {
+                    for(int k=0;k<=n;k++)
+                    {
+                        out[k]=(*this)(n,k);
+                    }
+                    continue;
+                }
+                const uint32_t* prev=&cells[rowOffset(n-1)];
+                out[0]=1;
+                out[n]=1;
+                for(int k=1;k<n;k++)
+                {
+                    uint32_t x=prev[k-1]+prev[k];
+                    out[k]= x>=p ? x-p : x;
+                }
+            }
+        };
+        std::vector<std::thread> pool;
+        for(int t=1;t<threads;t++)
+        {
+            pool.emplace_back(work,t);
+        }
+        work(0);
+        for(auto& th:pool)
+        {
+            th.join();
+        }
+        return cells;
+    }
+    uint32_t mod() const { return p; }
+private:
+    uint32_t power(uint64_t b,uint64_t e) const
+    {
+        uint64_t r=1;
+        b%=p;
+        while(e)
+        {
+            if(e&1)
+            {
+                r=r*b%p;
+            }
+            b=b*b%p;
+            e>>=1;
+        }
+        return r;
+    }
+    uint32_t p;
+    std::vector<uint32_t> fact;
+    std::vector<uint32_t> invFact;
+};
+
+}
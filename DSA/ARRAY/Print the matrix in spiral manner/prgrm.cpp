@@ -1,3 +1,85 @@
+#include "../Matrix/matrix.h"
+
+//lazy spiral walk : nothing is allocated , the state is the unvisited rectangle
+//[top..bottom] x [left..right] plus the leg being walked and the current cell
+//legs : 0 top row -> , 1 right column down , 2 bottom row <- , 3 left column up
+class SpiralIterator {
+public:
+    using iterator_category=forward_iterator_tag;
+    using value_type=int;
+    using difference_type=ptrdiff_t;
+    using pointer=const int*;
+    using reference=const int&;
+
+    SpiralIterator() = default;
+    SpiralIterator(MatrixView<const int> m,size_t remaining)
+        : matrix(m),bottom(m.rows()-1),right(m.cols()-1),remaining_(remaining) {}
+
+    const int& operator*() const { return matrix(r,c); }
+    const int* operator->() const { return &matrix(r,c); }
+    SpiralIterator& operator++()
+    {
+        //the unvisited rectangle is never empty while something is left , so every leg start is valid
+        if(--remaining_==0)
+        {
+            return *this;
+        }
+        switch(leg)
+        {
+            case 0:
+                if(c<right) { c++; }
+                else { top++; leg=1; r=top; c=right; }
+                break;
+            case 1:
+                if(r<bottom) { r++; }
+                else { right--; leg=2; r=bottom; c=right; }
+                break;
+            case 2:
+                if(c>left) { c--; }
+                else { bottom--; leg=3; r=bottom; c=left; }
+                break;
+            default:
+                if(r>top) { r--; }
+                else { left++; leg=0; r=top; c=left; }
+                break;
+        }
+        return *this;
+    }
+    SpiralIterator operator++(int)
+    {
+        SpiralIterator old=*this;
+        ++*this;
+        return old;
+    }
+    //two iterators of the same walk are equal when the same number of elements is left
+    bool operator==(const SpiralIterator& other) const { return remaining_==other.remaining_; }
+    bool operator!=(const SpiralIterator& other) const { return remaining_!=other.remaining_; }
+private:
+    MatrixView<const int> matrix;
+    int top=0;
+    int bottom=-1;
+    int left=0;
+    int right=-1;
+    int leg=0;
+    int r=0;
+    int c=0;
+    size_t remaining_=0;
+};
+
+//for(int x:SpiralRange(view)) visits the matrix in spiral order
+class SpiralRange {
+public:
+    explicit SpiralRange(MatrixView<const int> m) : matrix(m) {}
+    SpiralIterator begin() const { return SpiralIterator(matrix,size()); }
+    SpiralIterator end() const { return SpiralIterator(matrix,0); }
+    size_t size() const { return (size_t)matrix.rows()*matrix.cols(); }
+private:
+    MatrixView<const int> matrix;
+};
+
+//rings whose left / right columns are gathered together by spiralCopy
+static const int SPIRAL_BLOCK=16;
+
 class Solution {
 public:
     vector<int> spiralOrder(vector<vector<int>>& matrix) {
@@ -42,4 +124,74 @@ public:
 
         
     }
+    //flat / strided version : one allocation for the output , filled by spiralCopy
+    vector<int> spiralOrder(MatrixView<const int> matrix) {
+        vector<int> ans((size_t)matrix.rows()*matrix.cols());
+        spiralCopy(matrix,ans.data());
+        return ans;
+    }
+
+    //bulk spiral order into out[0 .. rows*cols) , returns the number of elements written
+    //ring k : top row k , bottom row rows-1-k , left column k , right column cols-1-k
+    //top / bottom legs are contiguous row segments -> memcpy / reverse copy
+    //right / left legs are columns : walking one column per ring touches a cache line per row
+    //for 4 bytes , so SPIRAL_BLOCK rings share one pass down the rows and each row gives
+    //a contiguous run of SPIRAL_BLOCK column values , one per ring
+    size_t spiralCopy(MatrixView<const int> matrix,int* out) {
+        int rows=matrix.rows();
+        int cols=matrix.cols();
+        int rings=(min(rows,cols)+1)/2;
+        //where ring k starts in out
+        size_t start=0;
+        size_t rightAt[SPIRAL_BLOCK];
+        size_t leftAt[SPIRAL_BLOCK];
+        for(int k0=0;k0<rings;k0+=SPIRAL_BLOCK)
+        {
+            int k1=min(k0+SPIRAL_BLOCK,rings);
+            for(int k=k0;k<k1;k++)
+            {
+                int top=k,bottom=rows-1-k,left=k,right=cols-1-k;
+                const int* row=matrix.row(top);
+                memcpy(out+start,row+left,sizeof(int)*(right-left+1));
+                size_t pos=start+(right-left+1);
+                rightAt[k-k0]=pos;
+                pos+=bottom-top;
+                leftAt[k-k0]=pos;
+                if(bottom>top)
+                {
+                    row=matrix.row(bottom);
+                    reverse_copy(row+left,row+right,out+pos);
+                    pos+=right-left;
+                    leftAt[k-k0]=pos;
+                    if(right>left)
+                    {
+                        pos+=bottom-top-1;
+                    }
+                }
+                start=pos;
+            }
+            //right legs : ring k covers rows k+1 .. rows-1-k of column cols-1-k
+            for(int i=k0+1;i<rows-k0;i++)
+            {
+                int kmax=min({k1-1,i-1,rows-1-i});
+                const int* row=matrix.row(i);
+                for(int k=k0;k<=kmax;k++)
+                {
+                    out[rightAt[k-k0]+(i-k-1)]=row[cols-1-k];
+                }
+            }
+            //left legs : ring k (if it has two columns) covers rows rows-2-k down to k+1 of column k
+            int kcol=min(k1-1,cols/2-1);
+            for(int i=k0+1;i<rows-1-k0;i++)
+            {
+                int kmax=min({kcol,i-1,rows-2-i});
+                const int* row=matrix.row(i);
+                for(int k=k0;k<=kmax;k++)
+                {
+                    out[leftAt[k-k0]+(rows-2-k-i)]=row[k];
+                }
+            }
+        }
+        return start;
+    }
 };
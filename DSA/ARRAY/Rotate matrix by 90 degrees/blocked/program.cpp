@@ -0,0 +1,388 @@
+#include<immintrin.h>
+#include "../../Matrix/matrix.h"
+
+//8x8 int tile kernels , rows given as pointers so the same kernel serves every angle :
+//listing the input rows bottom-up turns a transpose into a 90 degree clockwise turn ,
+//listing the output rows bottom-up turns it into 270
+static const int TILE=8;
+//64x64 ints = 16KB per block , a block pair fits in L1
+static const int BLOCK=64;
+
+static void transposeScalar(const int* const* in,int* const* out)
+{
+    int t[TILE][TILE];
+    for(int i=0;i<TILE;i++)
+    {
+        for(int j=0;j<TILE;j++)
+        {
+            t[j][i]=in[i][j];
+        }
+    }
+    for(int i=0;i<TILE;i++)
+    {
+        memcpy(out[i],t[i],sizeof(t[i]));
+    }
+}
+
+//tile a <- transpose(tile b) and tile b <- transpose(tile a) , a==b is a plain in place transpose
+static void swapTransposeScalar(int* const* a,int* const* b)
+{
+    int ta[TILE][TILE],tb[TILE][TILE];
+    for(int i=0;i<TILE;i++)
+    {
+        for(int j=0;j<TILE;j++)
+        {
+            ta[j][i]=a[i][j];
+            tb[j][i]=b[i][j];
+        }
+    }
+    for(int i=0;i<TILE;i++)
+    {
+        memcpy(b[i],ta[i],sizeof(ta[i]));
+        memcpy(a[i],tb[i],sizeof(tb[i]));
+    }
+}
+
+//r[0..8) rows in , r[0..8) columns out : 32-bit interleave , 64-bit interleave , 128-bit halves
+__attribute__((target("avx2")))
+static inline void transposeRegs(__m256i* r)
+{
+    __m256i t0=_mm256_unpacklo_epi32(r[0],r[1]);
+    __m256i t1=_mm256_unpackhi_epi32(r[0],r[1]);
+    __m256i t2=_mm256_unpacklo_epi32(r[2],r[3]);
+    __m256i t3=_mm256_unpackhi_epi32(r[2],r[3]);
+    __m256i t4=_mm256_unpacklo_epi32(r[4],r[5]);
+    __m256i t5=_mm256_unpackhi_epi32(r[4],r[5]);
+    __m256i t6=_mm256_unpacklo_epi32(r[6],r[7]);
+    __m256i t7=_mm256_unpackhi_epi32(r[6],r[7]);
+    __m256i u0=_mm256_unpacklo_epi64(t0,t2);
+    __m256i u1=_mm256_unpackhi_epi64(t0,t2);
+    __m256i u2=_mm256_unpacklo_epi64(t1,t3);
+    __m256i u3=_mm256_unpackhi_epi64(t1,t3);
+    __m256i u4=_mm256_unpacklo_epi64(t4,t6);
+    __m256i u5=_mm256_unpackhi_epi64(t4,t6);
+    __m256i u6=_mm256_unpacklo_epi64(t5,t7);
+    __m256i u7=_mm256_unpackhi_epi64(t5,t7);
+    r[0]=_mm256_permute2x128_si256(u0,u4,0x20);
+    r[1]=_mm256_permute2x128_si256(u1,u5,0x20);
+    r[2]=_mm256_permute2x128_si256(u2,u6,0x20);
+    r[3]=_mm256_permute2x128_si256(u3,u7,0x20);
+    r[4]=_mm256_permute2x128_si256(u0,u4,0x31);
+    r[5]=_mm256_permute2x128_si256(u1,u5,0x31);
+    r[6]=_mm256_permute2x128_si256(u2,u6,0x31);
+    r[7]=_mm256_permute2x128_si256(u3,u7,0x31);
+}
+
+__attribute__((target("avx2")))
+static void transposeAvx2(const int* const* in,int* const* out)
+{
+    __m256i r[TILE];
+    for(int i=0;i<TILE;i++)
+    {
+        r[i]=_mm256_loadu_si256((const __m256i*)in[i]);
+    }
+    transposeRegs(r);
+    for(int i=0;i<TILE;i++)
+    {
+        _mm256_storeu_si256((__m256i*)out[i],r[i]);
+    }
+}
+
+//both tiles live in registers before anything is stored
+__attribute__((target("avx2")))
+static void swapTransposeAvx2(int* const* a,int* const* b)
+{
+    __m256i ra[TILE],rb[TILE];
+    for(int i=0;i<TILE;i++)
+    {
+        ra[i]=_mm256_loadu_si256((const __m256i*)a[i]);
+        rb[i]=_mm256_loadu_si256((const __m256i*)b[i]);
+    }
+    transposeRegs(ra);
+    transposeRegs(rb);
+    for(int i=0;i<TILE;i++)
+    {
+        _mm256_storeu_si256((__m256i*)b[i],ra[i]);
+        _mm256_storeu_si256((__m256i*)a[i],rb[i]);
+    }
+}
+
+//a[0..n) <- reverse(b[0..n)) and b[0..n) <- reverse(a[0..n)) , a==b reverses one row in place
+static void reverseSwapScalar(int* a,int* b,int n)
+{
+    if(a==b)
+    {
+        reverse(a,a+n);
+        return;
+    }
+    for(int k=0;k<n;k++)
+    {
+        swap(a[k],b[n-1-k]);
+    }
+}
+
+__attribute__((target("avx2")))
+static void reverseSwapAvx2(int* a,int* b,int n)
+{
+    const __m256i rev=_mm256_setr_epi32(7,6,5,4,3,2,1,0);
+    //a==b : stop before the two ends meet , the middle is done scalar
+    int limit= a==b ? n/2 : n;
+    int k=0;
+    for(;k+TILE<=limit;k+=TILE)
+    {
+        __m256i x=_mm256_loadu_si256((const __m256i*)(a+k));
+        __m256i y=_mm256_loadu_si256((const __m256i*)(b+n-TILE-k));
+        _mm256_storeu_si256((__m256i*)(a+k),_mm256_permutevar8x32_epi32(y,rev));
+        _mm256_storeu_si256((__m256i*)(b+n-TILE-k),_mm256_permutevar8x32_epi32(x,rev));
+    }
+    for(;k<limit && (a!=b || k<n-1-k);k++)
+    {
+        swap(a[k],b[n-1-k]);
+    }
+}
+
+//dst[0..n) <- reverse(src[0..n))
+__attribute__((target("avx2")))
+static void reverseCopyAvx2(const int* src,int* dst,int n)
+{
+    const __m256i rev=_mm256_setr_epi32(7,6,5,4,3,2,1,0);
+    int k=0;
+    for(;k+TILE<=n;k+=TILE)
+    {
+        __m256i x=_mm256_loadu_si256((const __m256i*)(src+n-TILE-k));
+        _mm256_storeu_si256((__m256i*)(dst+k),_mm256_permutevar8x32_epi32(x,rev));
+    }
+    for(;k<n;k++)
+    {
+        dst[k]=src[n-1-k];
+    }
+}
+
+static void reverseCopyScalar(const int* src,int* dst,int n)
+{
+    reverse_copy(src,src+n,dst);
+}
+
+static const bool hasAvx2=[]
+{
+    __builtin_cpu_init();
+    return (bool)__builtin_cpu_supports("avx2");
+}();
+
+static void transposeTile(const int* const* in,int* const* out)
+{
+    hasAvx2 ? transposeAvx2(in,out) : transposeScalar(in,out);
+}
+
+static void swapTransposeTile(int* const* a,int* const* b)
+{
+    hasAvx2 ? swapTransposeAvx2(a,b) : swapTransposeScalar(a,b);
+}
+
+static void reverseSwap(int* a,int* b,int n)
+{
+    hasAvx2 ? reverseSwapAvx2(a,b,n) : reverseSwapScalar(a,b,n);
+}
+
+static void reverseCopy(const int* src,int* dst,int n)
+{
+    hasAvx2 ? reverseCopyAvx2(src,dst,n) : reverseCopyScalar(src,dst,n);
+}
+
+//body(i) for every i in [0,count) , indices handed out one by one so uneven work balances
+template<class F>
+static void parallelFor(int count,int threads,F body)
+{
+    threads=max(1,min(threads,count));
+    atomic<int> next(0);
+    auto work=[&]
+    {
+        int i;
+        while((i=next++)<count)
+        {
+            body(i);
+        }
+    };
+    vector<thread> pool;
+    for(int t=1;t<threads;t++)
+    {
+        pool.emplace_back(work);
+    }
+    work();
+    for(auto& th:pool)
+    {
+        th.join();
+    }
+}
+
+class Solution {
+public:
+    //in place clockwise rotation of a square matrix by 0 / 90 / 180 / 270 degrees
+    //90  = transpose , then reverse every row
+    //270 = transpose , then reverse the row order
+    //180 = row i <-> row n-1-i , both reversed
+    void rotateInPlace(MatrixView<int> matrix,int degrees,int threads=1)
+    {
+        assert(matrix.rows()==matrix.cols());
+        int n=matrix.rows();
+        int turns=((degrees/90)%4+4)%4;
+        if(turns==0 || n<=1)
+        {
+            return;
+        }
+        if(turns==2)
+        {
+            parallelFor((n+1)/2,threads,[&](int i)
+            {
+                reverseSwap(matrix.row(i),matrix.row(n-1-i),n);
+            });
+            return;
+        }
+        transposeInPlace(matrix,threads);
+        if(turns==1)
+        {
+            parallelFor(n,threads,[&](int i)
+            {
+                reverseSwap(matrix.row(i),matrix.row(i),n);
+            });
+        }
+        else
+        {
+            parallelFor(n/2,threads,[&](int i)
+            {
+                swap_ranges(matrix.row(i),matrix.row(i)+n,matrix.row(n-1-i));
+            });
+        }
+    }
+
+    //blocked in place transpose : block pairs (bi,bj) with bi<=bj , inside them 8x8 tile pairs
+    void transposeInPlace(MatrixView<int> matrix,int threads=1)
+    {
+        int n=matrix.rows();
+        //full 8x8 tiles cover [0,n8) x [0,n8)
+        int n8=n/TILE*TILE;
+        int blocks=(n8+BLOCK-1)/BLOCK;
+        //block row bi does blocks bi..blocks-1 : early rows are bigger and are handed out first
+        parallelFor(blocks,threads,[&](int bi)
+        {
+            int* a[TILE];
+            int* b[TILE];
+            int i0=bi*BLOCK,i1=min(i0+BLOCK,n8);
+            for(int bj=bi;bj<blocks;bj++)
+            {
+                int j0=bj*BLOCK,j1=min(j0+BLOCK,n8);
+                for(int i=i0;i<i1;i+=TILE)
+                {
+                    for(int j= bi==bj ? i : j0;j<j1;j+=TILE)
+                    {
+                        for(int k=0;k<TILE;k++)
+                        {
+                            a[k]=matrix.row(i+k)+j;
+                            b[k]=matrix.row(j+k)+i;
+                        }
+                        swapTransposeTile(a,b);
+                    }
+                }
+            }
+        });
+        //the last n-n8 (<8) rows and columns
+        for(int i=n8;i<n;i++)
+        {
+            for(int j=0;j<i;j++)
+            {
+                swap(matrix(i,j),matrix(j,i));
+            }
+        }
+    }
+
+    //out of place clockwise rotation of any rows x cols matrix
+    //dst must be cols x rows for 90 / 270 and rows x cols for 0 / 180 , and must not overlap src
+    void rotate(MatrixView<const int> src,MatrixView<int> dst,int degrees,int threads=1)
+    {
+        int rows=src.rows();
+        int cols=src.cols();
+        int turns=((degrees/90)%4+4)%4;
+        if(turns%2==0)
+        {
+            assert(dst.rows()==rows && dst.cols()==cols);
+            parallelFor(rows,threads,[&](int r)
+            {
+                if(turns==0)
+                {
+                    memcpy(dst.row(r),src.row(r),sizeof(int)*cols);
+                }
+                else
+                {
+                    reverseCopy(src.row(r),dst.row(rows-1-r),cols);
+                }
+            });
+            return;
+        }
+        assert(dst.rows()==cols && dst.cols()==rows);
+        //90  : dst(c , rows-1-r) = src(r , c)
+        //270 : dst(cols-1-c , r) = src(r , c)
+        auto at=[&](int r,int c) -> int&
+        {
+            return turns==1 ? dst(c,rows-1-r) : dst(cols-1-c,r);
+        };
+        int rows8=rows/TILE*TILE;
+        int cols8=cols/TILE*TILE;
+        //one band = BLOCK source rows , walked in BLOCK wide column blocks so the
+        //destination rows touched by a block stay in cache
+        int bands=(rows8+BLOCK-1)/BLOCK;
+        parallelFor(bands,threads,[&](int band)
+        {
+            const int* in[TILE];
+            int* out[TILE];
+            int r0=band*BLOCK,r1=min(r0+BLOCK,rows8);
+            for(int c0=0;c0<cols8;c0+=BLOCK)
+            {
+                int c1=min(c0+BLOCK,cols8);
+                for(int r=r0;r<r1;r+=TILE)
+                {
+                    for(int c=c0;c<c1;c+=TILE)
+                    {
+                        for(int k=0;k<TILE;k++)
+                        {
+                            if(turns==1)
+                            {
+                                in[k]=src.row(r+TILE-1-k)+c;
+                                out[k]=dst.row(c+k)+(rows-TILE-r);
+                            }
+                            else
+                            {
+                                in[k]=src.row(r+k)+c;
+                                out[k]=dst.row(cols-1-c-k)+r;
+                            }
+                        }
+                        transposeTile(in,out);
+                    }
+                }
+            }
+            //columns past the last full tile
+            for(int r=r0;r<r1;r++)
+            {
+                for(int c=cols8;c<cols;c++)
+                {
+                    at(r,c)=src(r,c);
+                }
+            }
+        });
+        //rows past the last full tile
+        for(int r=rows8;r<rows;r++)
+        {
+            for(int c=0;c<cols;c++)
+            {
+                at(r,c)=src(r,c);
+            }
+        }
+    }
+
+    Matrix<int> rotated(MatrixView<const int> src,int degrees,int threads=1)
+    {
+        int turns=((degrees/90)%4+4)%4;
+        Matrix<int> ans= turns%2 ? Matrix<int>(src.cols(),src.rows()) : Matrix<int>(src.rows(),src.cols());
+        rotate(src,ans,degrees,threads);
+        return ans;
+    }
+};
@@ -1,3 +1,5 @@
+#include "../../Matrix/matrix.h"
+
 vector<vector<int>> rotateMatrix(vector<vector<int>>& matrix) {
     vector<vector<int>> ans;    
     vector<int> temp;
@@ -12,3 +14,31 @@ vector<vector<int>> rotateMatrix(vector<vector<int>>& matrix) {
     }
     return ans;
 }
+
+//flat version : output allocated once , copied in small square tiles so
+//both the reads and the strided writes stay in cache (no push_back)
+//works for any rows x cols input , the result is cols x rows
+Matrix<int> rotateMatrix(MatrixView<const int> matrix)
+{
+    const int TILE=16;
+    int rows=matrix.rows();
+    int cols=matrix.cols();
+    Matrix<int> ans(cols,rows);
+    for(int i0=0;i0<rows;i0+=TILE)
+    {
+        int i1=min(i0+TILE,rows);
+        for(int j0=0;j0<cols;j0+=TILE)
+        {
+            int j1=min(j0+TILE,cols);
+            for(int i=i0;i<i1;i++)
+            {
+                const int* in=matrix.row(i);
+                for(int j=j0;j<j1;j++)
+                {
+                    ans(j,rows-1-i)=in[j];
+                }
+            }
+        }
+    }
+    return ans;
+}
@@ -1,22 +1,167 @@
+#include<emmintrin.h>
+
+//open-addressing flat hash index : value -> first index it appears at
+//Swiss-table layout : one control byte per slot (EMPTY or 7 hash bits) , slots in groups of 16 ,
+//one SSE2 compare checks a whole group . keys and indices live in flat arrays , no node per insert
+//built once over an array , then answers any number of targets against it
+class FlatIndex {
+public:
+    //nums[0..n) is only viewed , not copied : it has to outlive the index
+    FlatIndex(const int* nums,size_t n) : nums(nums) , n(n)
+    {
+        size_t groups=1;
+        //keep the load under 7/8
+        while(groups*GROUP*7<n*8)
+        {
+            groups*=2;
+        }
+        groupMask=groups-1;
+        ctrl.assign(groups*GROUP,EMPTY);
+        keys.resize(groups*GROUP);
+        idx.resize(groups*GROUP);
+        for(int i=0;i<(int)n;i++)
+        {
+            insert(nums[i],i);
+        }
+    }
+    //first index of key , -1 if it is not in the array
+    int find(int key) const
+    {
+        uint64_t h=hash(key);
+        __m128i tag=_mm_set1_epi8((char)(h>>57));
+        __m128i empty=_mm_set1_epi8(EMPTY);
+        size_t g=(h>>32)&groupMask;
+        for(size_t step=1;;step++)
+        {
+            __m128i c=_mm_loadu_si128((const __m128i*)(ctrl.data()+g*GROUP));
+            unsigned match=_mm_movemask_epi8(_mm_cmpeq_epi8(c,tag));
+            while(match)
+            {
+                size_t slot=g*GROUP+__builtin_ctz(match);
+                if(keys[slot]==key)
+                {
+                    return idx[slot];
+                }
+                match&=match-1;
+            }
+            //an empty slot in the group means the key was never placed further on
+            if(_mm_movemask_epi8(_mm_cmpeq_epi8(c,empty)))
+            {
+                return -1;
+            }
+            g=(g+step)&groupMask;
+        }
+    }
+    explicit FlatIndex(const vector<int>& nums) : FlatIndex(nums.data(),nums.size())
+    {
+    }
+    //{i , j} with j < i or {-1,-1} , same answer as Solution::twoSum :
+    //i is the smallest index that has a partner , j the first index of the complement
+    vector<int> twoSum(int target) const
+    {
+        for(int i=0;i<(int)n;i++)
+        {
+            //a complement outside int range cannot be in the array , casting it would wrap
+            long long need=(long long)target-nums[i];
+            if(need<INT_MIN || need>INT_MAX)
+            {
+                continue;
+            }
+            int j=find((int)need);
+            if(j>=0 && j<i)
+            {
+                return {i,j};
+            }
+        }
+        return {-1,-1};
+    }
+    //many targets against the same array , one answer pair per target
+    vector<vector<int>> twoSumBatch(const vector<int>& targets) const
+    {
+        vector<vector<int>> ans;
+        ans.reserve(targets.size());
+        for(int target:targets)
+        {
+            ans.push_back(twoSum(target));
+        }
+        return ans;
+    }
+private:
+    static constexpr int GROUP=16;
+    static constexpr int8_t EMPTY=-128;
+    const int* nums;
+    size_t n;
+    vector<int8_t> ctrl;
+    vector<int> keys;
+    vector<int> idx;
+    size_t groupMask;
+
+    static uint64_t hash(int key)
+    {
+        uint64_t h=(uint64_t)(uint32_t)key*0x9E3779B97F4A7C15ull;
+        return h^(h>>29);
+    }
+    //keeps the first index of a repeated value
+    void insert(int key,int i)
+    {
+        uint64_t h=hash(key);
+        int8_t tag=(int8_t)(h>>57);
+        __m128i tagv=_mm_set1_epi8(tag);
+        __m128i empty=_mm_set1_epi8(EMPTY);
+        size_t g=(h>>32)&groupMask;
+        for(size_t step=1;;step++)
+        {
+            __m128i c=_mm_loadu_si128((const __m128i*)(ctrl.data()+g*GROUP));
+            unsigned match=_mm_movemask_epi8(_mm_cmpeq_epi8(c,tagv));
+            while(match)
+            {
+                size_t slot=g*GROUP+__builtin_ctz(match);
+                if(keys[slot]==key)
+                {
+                    return;
+                }
+                match&=match-1;
+            }
+            unsigned free=_mm_movemask_epi8(_mm_cmpeq_epi8(c,empty));
+            if(free)
+            {
+                size_t slot=g*GROUP+__builtin_ctz(free);
+                ctrl[slot]=tag;
+                keys[slot]=key;
+                idx[slot]=i;
+                return;
+            }
+            g=(g+step)&groupMask;
+        }
+    }
+};
+
 class Solution {
 public:
-    vector<int> twoSum(vector<int> nums, int target) {
+    vector<int> twoSum(const vector<int>& nums, int target) {
         
         unordered_map<int,int>map;
         int n=nums.size();
-        int diff;
+        long long diff;
         for(int i=0;i<n;i++)
         {
-            diff=target-nums[i];
-            if(map.find(diff)!=map.end())
+            //in long long : target-nums[i] can leave int range (no partner then , as in FlatIndex)
+            diff=(long long)target-nums[i];
+            if(diff>=INT_MIN && diff<=INT_MAX && map.find(diff)!=map.end())
             {
                 return {i,map[diff]};
             }
-            map[nums[i]]=i;
+            //keep the first index of a repeated value (FlatIndex gives the same j)
+            map.insert({nums[i],i});
         }
         return {-1,-1};
               
     }
+    //batch mode : the index is built once and shared by every target , nums is never copied
+    vector<vector<int>> twoSumBatch(const vector<int>& nums, const vector<int>& targets) {
+        FlatIndex index(nums);
+        return index.twoSumBatch(targets);
+    }
 
     
 };
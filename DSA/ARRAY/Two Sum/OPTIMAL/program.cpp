@@ -1,30 +1,32 @@
+#include "../../../SORTING/RADIX SORT/radix.h"
+
 class Solution {
 public:
-    vector<int> twoSum(vector<int> nums, int target) {
+    vector<int> twoSum(const vector<int>& nums, int target) {
         
         int n=nums.size();
-        
-        vector<vector<int>> eleIndex;
-        vector<int> ans;
+        if(n<2)
+        {
+            return {-1,-1};
+        }
+        //(value , index) packed in one 64-bit word : value (sign flipped) on top , index below
+        //-> one flat array , no allocation per element , sorting the words sorts by value
+        vector<uint64_t> eleIndex(n);
         for(int i=0;i<n;i++)
         {
-            eleIndex.push_back({nums[i],i});
+            eleIndex[i]=((uint64_t)((uint32_t)nums[i]^0x80000000u)<<32)|(uint32_t)i;
         }
+        sortByValue(eleIndex);
         int left=0;
-        int right =eleIndex.size()-1;
-        sort(eleIndex.begin(),eleIndex.end(),[](const vector<int>& a, const vector<int>& b)
-        {
-            return a[0]<b[0];
-        });
+        int right =n-1;
         while(left<right)
         {
-            if(eleIndex[left][0]+eleIndex[right][0]==target)
+            long long sum=(long long)value(eleIndex[left])+value(eleIndex[right]);
+            if(sum==target)
             {
-                ans.push_back(eleIndex[left][1]);
-                ans.push_back(eleIndex[right][1]);
-                return ans;
+                return {(int)(uint32_t)eleIndex[left],(int)(uint32_t)eleIndex[right]};
             }
-            else if(eleIndex[left][0]+eleIndex[right][0]<target)
+            else if(sum<target)
             {
                 left++;
             }
@@ -36,6 +38,23 @@ public:
 
               
     }
+    int value(uint64_t packed)
+    {
+        return (int)((uint32_t)(packed>>32)^0x80000000u);
+    }
+    //LSD radix sort (SORTING/RADIX SORT/radix.h) on the top 32 bits only ,
+    //the index bits are already in order and every pass is stable
+    void sortByValue(vector<uint64_t>& a)
+    {
+        vector<uint64_t> tmp(a.size());
+        vector<unsigned> count(RADIX_PASSES*RADIX_BUCKETS,0);
+        radixHistogram(a.data(),a.size(),32,count.data(),[](uint64_t key){ return key; });
+        uint64_t* sorted=radixScatter(a.data(),tmp.data(),a.size(),32,count.data());
+        if(sorted!=a.data())
+        {
+            copy(sorted,sorted+a.size(),a.begin());
+        }
+    }
 
     
 };
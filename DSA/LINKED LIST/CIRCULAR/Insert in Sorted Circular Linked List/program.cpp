@@ -1,15 +1,7 @@
-/* structure for a node
-class Node {
- public:
-  int data;
-  Node *next;
-
-  Node(int x){
-      data = x;
-      next = NULL;
-  }
-}; */
+#include "../ring_node.h"
 
+//structure for a node : ../ring_node.h , the judge's Node deriving from Pooled<Node>
+//-> every new Node below comes from the per-thread pool , consecutive inserts share slabs
 class Solution {
   public:
     Node* sortedInsert(Node* head, int data) {
@@ -0,0 +1,431 @@
+//lock-free sorted circular list (Harris / Michael style)
+//the ring closes through a sentinel : sentinel -> 3 -> 12 -> 40 -> sentinel
+//the sentinel is both "before the smallest" and "after the largest" , it is never deleted
+//
+//delete = two steps :
+//  1. mark   : set the low bit of victim->next (logical delete , nobody may link after it any more)
+//  2. unlink : CAS pred->next from victim to victim's successor (any thread that walks past may do it)
+//a node is never freed right away (the old `delete temp`) : another thread may still be standing on it
+//it is retired to the epoch domain and freed once every thread has moved two epochs on
+#pragma once
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<mutex>
+#include<utility>
+#include<vector>
+
+//epoch based reclamation for one node type
+//a thread pins the current epoch for the duration of one operation (Guard) ;
+//the global epoch moves on only when every pinned thread has seen it ,
+//so a node retired in epoch e is unreachable for everybody once the epoch is e + 2
+template<class NodeT>
+class EpochDomain {
+    struct Record;
+
+public:
+    class Guard {
+    public:
+        Guard() : rec(record()) { pin(rec); }
+        ~Guard() { unpin(rec); }
+        Guard(const Guard&)=delete;
+        Guard& operator=(const Guard&)=delete;
+    private:
+        Record* rec;
+    };
+
+    //node already unlinked : freed with delete two epochs later , caller must hold a Guard
+    static void retire(NodeT* node)
+    {
+        Record* r=record();
+        //the epoch now , not the pinned one : the global epoch may already be one ahead ,
+        //and threads pinned there can still hold the node
+        //the fence keeps the load after the unlink (a release CAS alone lets it move up) ,
+        //otherwise the node could be tagged one epoch too early
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        uint64_t e=globalEpoch().load(std::memory_order_acquire);
+        size_t b=e%3;
+        if(r->bagEpoch[b]!=e)
+        {
+            //bag still holds epoch e - 3 (or older) : safe to empty
+            freeBag(r,b);
+            r->bagEpoch[b]=e;
+        }
+        r->bag[b].push_back(node);
+        if(++r->sinceAdvance>=RETIRE_ADVANCE)
+        {
+            r->sinceAdvance=0;
+            tryAdvance();
+        }
+    }
+
+    //quiescent point (shutdown , between phases) : frees everything retired by finished threads and
+    //by the calling thread ; only valid while no thread is inside an operation on this node type
+    static void drain()
+    {
+        Record* r=record();
+        for(size_t b=0;b<3;b++)
+        {
+            freeBag(r,b);
+        }
+        Orphans& o=orphans();
+        std::lock_guard<std::mutex> lock(o.m);
+        for(auto& bag : o.bags)
+        {
+            for(NodeT* p : bag.second)
+            {
+                delete p;
+            }
+        }
+        o.bags.clear();
+    }
+
+private:
+    //retires per thread between two attempts to move the global epoch on
+    static const unsigned RETIRE_ADVANCE=64;
+
+    struct Record {
+        std::atomic<uint64_t> state{0};     //(epoch << 1) | pinned
+        std::atomic<bool> owned{false};
+        Record* next=nullptr;
+        unsigned depth=0;
+        uint64_t pinnedEpoch=0;
+        unsigned sinceAdvance=0;
+        std::vector<NodeT*> bag[3];
+        uint64_t bagEpoch[3]={0,0,0};
+    };
+    //a thread owns one record while it lives , a finished thread's record is taken over by the
+    //next new thread ; its bags are not left behind with it but handed to the orphan list
+    struct Owner {
+        Record* rec=nullptr;
+        ~Owner()
+        {
+            if(rec!=nullptr)
+            {
+                orphan(rec);
+                rec->owned.store(false,std::memory_order_release);
+            }
+        }
+    };
+    //bags of finished threads , freed by whichever thread next moves the epoch far enough
+    struct Orphans {
+        std::mutex m;
+        std::vector<std::pair<uint64_t,std::vector<NodeT*>>> bags;
+    };
+
+    static std::atomic<uint64_t>& globalEpoch()
+    {
+        static std::atomic<uint64_t> e{3};
+        return e;
+    }
+    static std::atomic<Record*>& records()
+    {
+        static std::atomic<Record*> head{nullptr};
+        return head;
+    }
+
+    static Orphans& orphans()
+    {
+        static Orphans o;
+        return o;
+    }
+
+    static Record* record()
+    {
+        static thread_local Owner owner;
+        if(owner.rec==nullptr)
+        {
+            owner.rec=acquire();
+        }
+        return owner.rec;
+    }
+
+    //free record if there is one , otherwise a new one pushed on the (grow only) list
+    static Record* acquire()
+    {
+        for(Record* r=records().load(std::memory_order_acquire);r!=nullptr;r=r->next)
+        {
+            bool expected=false;
+            if(!r->owned.load(std::memory_order_relaxed) &&
+               r->owned.compare_exchange_strong(expected,true,std::memory_order_acquire))
+            {
+                return r;
+            }
+        }
+        Record* r=new Record();
+        r->owned.store(true,std::memory_order_relaxed);
+        Record* old=records().load(std::memory_order_relaxed);
+        do
+        {
+            r->next=old;
+        } while(!records().compare_exchange_weak(old,r,std::memory_order_release,std::memory_order_relaxed));
+        return r;
+    }
+
+    static void pin(Record* r)
+    {
+        if(r->depth++>0)
+        {
+            return;
+        }
+        //acquire : pairs with the release of the advance , which came after every unpin it saw
+        uint64_t e=globalEpoch().load(std::memory_order_acquire);
+        r->state.store((e<<1) | 1,std::memory_order_seq_cst);
+        //the pin must be visible before any node pointer is read
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        r->pinnedEpoch=e;
+        //bags two or more epochs old can go
+        for(size_t b=0;b<3;b++)
+        {
+            if(!r->bag[b].empty() && r->bagEpoch[b]+2<=e)
+            {
+                freeBag(r,b);
+            }
+        }
+    }
+
+    static void unpin(Record* r)
+    {
+        if(--r->depth>0)
+        {
+            return;
+        }
+        r->state.store(r->pinnedEpoch<<1,std::memory_order_release);
+    }
+
+    static void tryAdvance()
+    {
+        uint64_t e=globalEpoch().load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for(Record* r=records().load(std::memory_order_acquire);r!=nullptr;r=r->next)
+        {
+            uint64_t s=r->state.load(std::memory_order_acquire);
+            if((s & 1) && (s>>1)!=e)
+            {
+                //somebody still works in an older epoch
+                return;
+            }
+        }
+        if(globalEpoch().compare_exchange_strong(e,e+1,std::memory_order_acq_rel,std::memory_order_relaxed))
+        {
+            freeOrphans(e+1);
+        }
+    }
+
+    static void orphan(Record* r)
+    {
+        Orphans& o=orphans();
+        std::lock_guard<std::mutex> lock(o.m);
+        for(size_t b=0;b<3;b++)
+        {
+            if(!r->bag[b].empty())
+            {
+                o.bags.emplace_back(r->bagEpoch[b],std::move(r->bag[b]));
+                r->bag[b].clear();
+            }
+        }
+    }
+
+    //try_lock : a retiring thread never waits here , a busy list is simply left for the next advance
+    static void freeOrphans(uint64_t e)
+    {
+        Orphans& o=orphans();
+        std::unique_lock<std::mutex> lock(o.m,std::try_to_lock);
+        if(!lock.owns_lock())
+        {
+            return;
+        }
+        size_t kept=0;
+        for(size_t i=0;i<o.bags.size();i++)
+        {
+            if(o.bags[i].first+2<=e)
+            {
+                for(NodeT* p : o.bags[i].second)
+                {
+                    delete p;
+                }
+            }
+            else
+            {
+                if(kept!=i)
+                {
+                    o.bags[kept]=std::move(o.bags[i]);
+                }
+                kept++;
+            }
+        }
+        o.bags.resize(kept);
+    }
+
+    static void freeBag(Record* r,size_t b)
+    {
+        for(NodeT* p : r->bag[b])
+        {
+            delete p;
+        }
+        r->bag[b].clear();
+    }
+};
+
+template<class T=int>
+class LockFreeRing {
+public:
+    struct Node {
+        T data;
+        std::atomic<uintptr_t> next;    //successor | deleted bit
+        Node() : data(),next(0) {}
+        explicit Node(const T& x) : data(x),next(0) {}
+    };
+    using Domain=EpochDomain<Node>;
+
+    LockFreeRing()
+    {
+        sentinel.next.store(pack(&sentinel),std::memory_order_relaxed);
+    }
+    LockFreeRing(const LockFreeRing&)=delete;
+    LockFreeRing& operator=(const LockFreeRing&)=delete;
+    //no other thread may use the ring any more ; nodes retired earlier stay with the domain
+    ~LockFreeRing()
+    {
+        Node* p=ptr(sentinel.next.load(std::memory_order_relaxed));
+        while(p!=&sentinel)
+        {
+            Node* where_next=ptr(p->next.load(std::memory_order_relaxed));
+            delete p;
+            p=where_next;
+        }
+    }
+
+    //sortedInsert : the new node goes before the first node with data >= x
+    void sortedInsert(const T& x)
+    {
+        typename Domain::Guard g;
+        Node* temp=new Node(x);
+        while(true)
+        {
+            std::pair<Node*,Node*> w=search(x);
+            temp->next.store(pack(w.second),std::memory_order_relaxed);
+            uintptr_t expected=pack(w.second);
+            if(w.first->next.compare_exchange_strong(expected,pack(temp),std::memory_order_release,std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+    }
+
+    //deleteNode : first node with data == key , false if there is none
+    bool deleteNode(const T& key)
+    {
+        typename Domain::Guard g;
+        while(true)
+        {
+            std::pair<Node*,Node*> w=search(key);
+            Node* temp=w.second;
+            if(temp==&sentinel || key<temp->data)
+            {
+                return false;
+            }
+            uintptr_t succ=temp->next.load(std::memory_order_acquire);
+            if(marked(succ))
+            {
+                continue;
+            }
+            //1. mark : from here on the node is deleted , whoever unlinks it
+            if(!temp->next.compare_exchange_strong(succ,succ | 1,std::memory_order_acq_rel,std::memory_order_relaxed))
+            {
+                continue;
+            }
+            //2. unlink , or leave it to the next search that walks past
+            uintptr_t expected=pack(temp);
+            if(w.first->next.compare_exchange_strong(expected,succ,std::memory_order_release,std::memory_order_relaxed))
+            {
+                Domain::retire(temp);
+            }
+            else
+            {
+                search(key);
+            }
+            return true;
+        }
+    }
+
+    //read only walk , never helps , never retries
+    //duplicates : a deleted copy of key may sit in front of a live one , so deleted equal
+    //nodes are walked past until a live copy or a larger value
+    bool contains(const T& key) const
+    {
+        typename Domain::Guard g;
+        const Node* p=ptr(sentinel.next.load(std::memory_order_acquire));
+        while(p!=&sentinel && p->data<key)
+        {
+            p=ptr(p->next.load(std::memory_order_acquire));
+        }
+        while(p!=&sentinel && !(key<p->data))
+        {
+            uintptr_t nx=p->next.load(std::memory_order_acquire);
+            if(!marked(nx))
+            {
+                return true;
+            }
+            p=ptr(nx);
+        }
+        return false;
+    }
+
+    //one lap around the ring , f(value) for every node not deleted when it was passed
+    //(a snapshot only if nobody writes meanwhile)
+    template<class F>
+    void forEach(F f) const
+    {
+        typename Domain::Guard g;
+        const Node* p=ptr(sentinel.next.load(std::memory_order_acquire));
+        while(p!=&sentinel)
+        {
+            uintptr_t nx=p->next.load(std::memory_order_acquire);
+            if(!marked(nx))
+            {
+                f(p->data);
+            }
+            p=ptr(nx);
+        }
+    }
+
+private:
+    Node sentinel;
+
+    static Node* ptr(uintptr_t u) { return reinterpret_cast<Node*>(u & ~uintptr_t(1)); }
+    static bool marked(uintptr_t u) { return (u & 1)!=0; }
+    static uintptr_t pack(const Node* p) { return reinterpret_cast<uintptr_t>(p); }
+
+    //(pred , curr) : pred->data < key <= curr->data , both unmarked when seen , pred->next == curr
+    //curr == sentinel when every value is smaller ; marked nodes on the way are unlinked and retired
+    std::pair<Node*,Node*> search(const T& key)
+    {
+    retry:
+        Node* pred=&sentinel;
+        Node* curr=ptr(pred->next.load(std::memory_order_acquire));
+        while(curr!=&sentinel)
+        {
+            uintptr_t succ=curr->next.load(std::memory_order_acquire);
+            if(marked(succ))
+            {
+                uintptr_t expected=pack(curr);
+                if(!pred->next.compare_exchange_strong(expected,succ & ~uintptr_t(1),std::memory_order_acq_rel,std::memory_order_relaxed))
+                {
+                    //pred changed or got marked itself : start over
+                    goto retry;
+                }
+                Domain::retire(curr);
+                curr=ptr(succ);
+                continue;
+            }
+            if(!(curr->data<key))
+            {
+                break;
+            }
+            pred=curr;
+            curr=ptr(succ);
+        }
+        return {pred,curr};
+    }
+};
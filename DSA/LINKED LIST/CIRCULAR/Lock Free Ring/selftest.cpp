@@ -0,0 +1,299 @@
+#include<bits/stdc++.h>
+#include "lockfree_ring.h"
+using namespace std;
+
+//the single-threaded ring of sortedInsert / deleteNode behind one global mutex : the baseline
+class MutexRing {
+    struct Node {
+        int data;
+        Node* next;
+        Node(int x) : data(x),next(nullptr) {}
+    };
+    Node* head=nullptr;
+    mutex m;
+public:
+    ~MutexRing()
+    {
+        if(head==nullptr)
+        {
+            return;
+        }
+        Node* p=head->next;
+        while(p!=head)
+        {
+            Node* where_next=p->next;
+            delete p;
+            p=where_next;
+        }
+        delete head;
+    }
+    void sortedInsert(int data)
+    {
+        lock_guard<mutex> lock(m);
+        Node* temp=new Node(data);
+        if(head==nullptr)
+        {
+            temp->next=temp;
+            head=temp;
+            return;
+        }
+        Node* p=head;
+        if(data<head->data)
+        {
+            while(p->next!=head)
+            {
+                p=p->next;
+            }
+            temp->next=head;
+            p->next=temp;
+            head=temp;
+            return;
+        }
+        while(p->next!=head && p->next->data<data)
+        {
+            p=p->next;
+        }
+        temp->next=p->next;
+        p->next=temp;
+    }
+    bool deleteNode(int key)
+    {
+        lock_guard<mutex> lock(m);
+        if(head==nullptr)
+        {
+            return false;
+        }
+        Node* p=head;
+        while(p->next!=head && p->next->data!=key)
+        {
+            p=p->next;
+        }
+        Node* temp=p->next;
+        if(temp->data!=key)
+        {
+            return false;
+        }
+        if(temp==p)
+        {
+            head=nullptr;
+        }
+        else
+        {
+            p->next=temp->next;
+            if(temp==head)
+            {
+                head=temp->next;
+            }
+        }
+        delete temp;
+        return true;
+    }
+    bool contains(int key)
+    {
+        lock_guard<mutex> lock(m);
+        if(head==nullptr)
+        {
+            return false;
+        }
+        Node* p=head;
+        do
+        {
+            if(p->data>=key)
+            {
+                return p->data==key;
+            }
+            p=p->next;
+        } while(p!=head);
+        return false;
+    }
+};
+
+//threads x ops on one ring , in rounds so finished threads hand their records (and retired nodes) on
+//private keys : thread t owns every key == t mod threads , so each of its deletes and lookups must succeed
+//shared keys (negative) : inserted and deleted by everyone at once
+//DUP : one copy stays in the ring throughout while every thread adds and deletes more copies ,
+//so contains(DUP) must never fail , however many deleted copies sit in front of the live one
+//at the end the ring must be sorted and hold exactly the private keys still owned (and DUP once)
+int stressTest(int threads,int ops)
+{
+    const int DUP=-100;
+    LockFreeRing<int> ring;
+    ring.sortedInsert(DUP);
+    vector<vector<int>> own(threads);
+    atomic<bool> failed{false};
+    const int rounds=4;
+    for(int round=0;round<rounds;round++)
+    {
+        vector<thread> pool;
+        for(int t=0;t<threads;t++)
+        {
+            pool.emplace_back([&,t,round]
+            {
+                mt19937 rng(round*threads+t+1);
+                vector<int>& mine=own[t];
+                for(int i=0;i<ops/rounds;i++)
+                {
+                    int op=rng()%4;
+                    if(op==0)
+                    {
+                        int x=(int)(rng()%1000)*threads+t;
+                        ring.sortedInsert(x);
+                        mine.push_back(x);
+                    }
+                    else if(op==1 && !mine.empty())
+                    {
+                        size_t k=rng()%mine.size();
+                        if(!ring.deleteNode(mine[k]))
+                        {
+                            failed=true;
+                        }
+                        mine[k]=mine.back();
+                        mine.pop_back();
+                    }
+                    else if(op==2)
+                    {
+                        int x= rng()%2 ? DUP : -1-(int)(rng()%50);
+                        ring.sortedInsert(x);
+                        ring.deleteNode(x);
+                        if(!ring.contains(DUP))
+                        {
+                            failed=true;
+                        }
+                    }
+                    else if(!mine.empty() && !ring.contains(mine[rng()%mine.size()]))
+                    {
+                        failed=true;
+                    }
+                }
+            });
+        }
+        for(auto& th:pool)
+        {
+            th.join();
+        }
+    }
+    //duplicate phase : writers only churn copies of DUP right in front of the live one ,
+    //a reader asks for it the whole time
+    {
+        atomic<bool> stop{false};
+        vector<thread> pool;
+        for(int t=0;t<max(threads-1,1);t++)
+        {
+            pool.emplace_back([&]
+            {
+                while(!stop.load(memory_order_relaxed))
+                {
+                    ring.sortedInsert(DUP);
+                    ring.deleteNode(DUP);
+                }
+            });
+        }
+        for(int i=0;i<ops;i++)
+        {
+            if(!ring.contains(DUP))
+            {
+                failed=true;
+            }
+        }
+        stop=true;
+        for(auto& th:pool)
+        {
+            th.join();
+        }
+    }
+    vector<int> got;
+    ring.forEach([&](int x){ got.push_back(x); });
+    vector<int> expect{DUP};
+    for(auto& mine:own)
+    {
+        expect.insert(expect.end(),mine.begin(),mine.end());
+    }
+    sort(expect.begin(),expect.end());
+    //every shared insert was followed by one delete of the same key -> none may be left
+    bool ok=!failed && is_sorted(got.begin(),got.end()) && got==expect;
+    //every worker has exited : whatever they retired is in the orphan list
+    LockFreeRing<int>::Domain::drain();
+    cout<<(ok ? "PASS" : "FAIL")<<" : stress "<<threads<<" threads x "<<ops<<" ops , "<<got.size()<<" keys left"<<endl;
+    return ok ? 0 : 1;
+}
+
+//Mops/s over all threads : ~keys/2 of keys present , an update deletes the key or inserts it if absent
+template<class Ring>
+double throughput(int threads,int updatePercent,int keys,int ops)
+{
+    Ring ring;
+    for(int k=0;k<keys;k+=2)
+    {
+        ring.sortedInsert(k);
+    }
+    atomic<long> sink{0};
+    vector<thread> pool;
+    auto start=chrono::steady_clock::now();
+    for(int t=0;t<threads;t++)
+    {
+        pool.emplace_back([&,t]
+        {
+            mt19937 rng(t+7);
+            long found=0;
+            for(int i=0;i<ops/threads;i++)
+            {
+                int x=rng()%keys;
+                if((int)(rng()%100)<updatePercent)
+                {
+                    if(!ring.deleteNode(x))
+                    {
+                        ring.sortedInsert(x);
+                    }
+                }
+                else
+                {
+                    found+=ring.contains(x);
+                }
+            }
+            sink+=found;
+        });
+    }
+    for(auto& th:pool)
+    {
+        th.join();
+    }
+    double sec=chrono::duration<double>(chrono::steady_clock::now()-start).count();
+    if constexpr(is_same<Ring,LockFreeRing<int>>::value)
+    {
+        LockFreeRing<int>::Domain::drain();
+    }
+    return ops/sec/1e6;
+}
+
+int bench(int maxThreads)
+{
+    const int keys=2000;
+    const int ops=200000;
+    cout<<"Mops/s , "<<keys<<" keys , "<<ops<<" ops , hardware threads : "<<thread::hardware_concurrency()<<endl;
+    for(int updates:{50,10})
+    {
+        cout<<updates<<"% updates"<<endl;
+        for(int t=1;t<=maxThreads;t*=2)
+        {
+            double lf=throughput<LockFreeRing<int>>(t,updates,keys,ops);
+            double mx=throughput<MutexRing>(t,updates,keys,ops);
+            cout<<"  threads "<<setw(2)<<t<<"   lock-free "<<fixed<<setprecision(2)<<lf<<"   mutex ring "<<mx<<endl;
+        }
+    }
+    return 0;
+}
+
+int main(int argc,char** argv) {
+    string mode= argc>=2 ? argv[1] : "";
+    if(mode=="--stress")
+    {
+        return stressTest(argc>=3 ? stoi(argv[2]) : 16,argc>=4 ? stoi(argv[3]) : 50000);
+    }
+    if(mode=="--bench")
+    {
+        return bench(argc>=3 ? stoi(argv[2]) : 32);
+    }
+    cerr<<"usage: "<<argv[0]<<" --stress [threads=16] [ops per thread=50000]"<<endl;
+    cerr<<"       "<<argv[0]<<" --bench [max threads=32]"<<endl;
+    return 1;
+}
@@ -0,0 +1,271 @@
+//sorted circular list backed by a skip list
+//level 0 is the ring itself : node->next , tail->next == head , same as the Node of
+//sortedInsert / deleteNode , so existing circular walks keep working
+//levels 1.. are express lanes (null terminated) that skip ~4^l nodes per hop
+//tail is cached , so a new head / a deleted head no longer walks the ring
+//insert , delete , lookup : O(log n) expected
+#pragma once
+#include<algorithm>
+#include<cstddef>
+#include<cstdint>
+#include<new>
+#include<type_traits>
+
+template<class T=int>
+class SkipRing {
+    static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value,
+                  "the header node carries no value");
+
+public:
+    //a node is one level-0 ring node followed by its express-lane links
+    struct Node {
+        T data;
+        Node* next;
+        uint32_t level;
+        Node* up[1];    //up[l-1] : link on level l , over-allocated to level-1 entries
+    };
+
+    static constexpr int MAX_LEVEL=16;
+
+    explicit SkipRing(uint64_t seed=0x9E3779B97F4A7C15ull)
+        : header(allocNode(MAX_LEVEL)),last(nullptr),levels(1),n(0),rng(seed | 1)
+    {
+        for(int l=0;l<MAX_LEVEL;l++)
+        {
+            link(header,l)=nullptr;
+        }
+    }
+    SkipRing(const SkipRing&)=delete;
+    SkipRing& operator=(const SkipRing&)=delete;
+    ~SkipRing()
+    {
+        clear();
+        ::operator delete(header);
+    }
+
+    //circular iteration : do { ... p=p->next; } while(p!=head());
+    Node* head() const { return header->next; }
+    Node* tail() const { return last; }
+    size_t size() const { return n; }
+    bool empty() const { return n==0; }
+
+    //f(node) once per node , head to tail
+    template<class F>
+    void forEach(F f) const
+    {
+        Node* h=head();
+        if(h==nullptr)
+        {
+            return;
+        }
+        Node* p=h;
+        do
+        {
+            f(p);
+            p=p->next;
+        } while(p!=h);
+    }
+
+    //sortedInsert : returns the (possibly new) head like the ring version
+    //equal values go after the existing ones
+    Node* sortedInsert(const T& data)
+    {
+        Node* update[MAX_LEVEL];
+        findPredecessors(data,true,update);
+        int lvl=randomLevel();
+        if(lvl>levels)
+        {
+            for(int l=levels;l<lvl;l++)
+            {
+                update[l]=header;
+            }
+            levels=lvl;
+        }
+        Node* temp=allocNode(lvl);
+        new(&temp->data) T(data);
+        for(int l=1;l<lvl;l++)
+        {
+            link(temp,l)=link(update[l],l);
+            link(update[l],l)=temp;
+        }
+        //level 0 : the ring
+        Node* p=update[0];
+        if(last==nullptr)
+        {
+            //empty case
+            temp->next=temp;
+            header->next=temp;
+            last=temp;
+        }
+        else if(p==header)
+        {
+            //head case : the cached tail closes the ring , no walk
+            temp->next=header->next;
+            last->next=temp;
+            header->next=temp;
+        }
+        else
+        {
+            temp->next=p->next;
+            p->next=temp;
+            if(p==last)
+            {
+                last=temp;
+            }
+        }
+        n++;
+        return head();
+    }
+
+    //deleteNode : first node with data == key removed , returns the head (nullptr once empty)
+    Node* deleteNode(const T& key)
+    {
+        if(last==nullptr)
+        {
+            return nullptr;
+        }
+        Node* update[MAX_LEVEL];
+        findPredecessors(key,false,update);
+        Node* p=update[0];
+        if(p==last)
+        {
+            return head();
+        }
+        Node* temp=p->next;
+        if(temp->data<key || key<temp->data)
+        {
+            return head();
+        }
+        for(int l=1;l<static_cast<int>(temp->level);l++)
+        {
+            if(link(update[l],l)==temp)
+            {
+                link(update[l],l)=link(temp,l);
+            }
+        }
+        if(temp->next==temp)
+        {
+            //single node case
+            header->next=nullptr;
+            last=nullptr;
+        }
+        else
+        {
+            //p is the header for the head , otherwise the real predecessor
+            if(p==header)
+            {
+                header->next=temp->next;
+                last->next=temp->next;
+            }
+            else
+            {
+                p->next=temp->next;
+                if(temp==last)
+                {
+                    last=p;
+                }
+            }
+        }
+        ::operator delete(temp);
+        n--;
+        while(levels>1 && link(header,levels-1)==nullptr)
+        {
+            levels--;
+        }
+        return head();
+    }
+
+    //first node with data == key , nullptr if there is none
+    Node* find(const T& key) const
+    {
+        Node* q=lowerBound(key);
+        return (q!=nullptr && !(key<q->data)) ? q : nullptr;
+    }
+
+    //first node with data >= key , nullptr if every value is smaller
+    Node* lowerBound(const T& key) const
+    {
+        if(last==nullptr)
+        {
+            return nullptr;
+        }
+        Node* update[MAX_LEVEL];
+        findPredecessors(key,false,update);
+        return (update[0]==last) ? nullptr : update[0]->next;
+    }
+
+    void clear()
+    {
+        Node* h=head();
+        if(h!=nullptr)
+        {
+            last->next=nullptr;
+            while(h!=nullptr)
+            {
+                Node* where_next=h->next;
+                ::operator delete(h);
+                h=where_next;
+            }
+        }
+        for(int l=0;l<MAX_LEVEL;l++)
+        {
+            link(header,l)=nullptr;
+        }
+        last=nullptr;
+        levels=1;
+        n=0;
+    }
+
+private:
+    Node* header;   //links only , never part of the ring
+    Node* last;
+    int levels;
+    size_t n;
+    uint64_t rng;
+
+    static Node*& link(Node* p,int l)
+    {
+        return (l==0) ? p->next : p->up[l-1];
+    }
+
+    static Node* allocNode(int lvl)
+    {
+        //never less than sizeof(Node) : a level-1 node still has to hold the whole struct (up[0] , padding)
+        size_t bytes=std::max(sizeof(Node),offsetof(Node,up)+lvl*sizeof(Node*));
+        Node* p=static_cast<Node*>(::operator new(bytes));
+        p->level=static_cast<uint32_t>(lvl);
+        return p;
+    }
+
+    //P(level > l) = 4^-l
+    int randomLevel()
+    {
+        rng^=rng<<13;
+        rng^=rng>>7;
+        rng^=rng<<17;
+        int lvl=1+__builtin_ctzll(rng | (1ull<<62))/2;
+        return lvl<MAX_LEVEL ? lvl : MAX_LEVEL;
+    }
+
+    //update[l] = last node on level l with data < x (data <= x when after is set) , or the header
+    //level 0 stops at the tail : after it the ring wraps to the head
+    void findPredecessors(const T& x,bool after,Node** update) const
+    {
+        Node* p=header;
+        for(int l=levels-1;l>=1;l--)
+        {
+            Node* q=link(p,l);
+            while(q!=nullptr && (after ? !(x<q->data) : q->data<x))
+            {
+                p=q;
+                q=link(p,l);
+            }
+            update[l]=p;
+        }
+        while(last!=nullptr && p!=last && (after ? !(x<p->next->data) : p->next->data<x))
+        {
+            p=p->next;
+        }
+        update[0]=p;
+    }
+};
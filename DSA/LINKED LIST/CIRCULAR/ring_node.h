@@ -0,0 +1,15 @@
+//node of the circular list solutions (Insert in Sorted / Deletion in Circular Linked List) ,
+//the judge's Node with the pool mixed in : new Node(x) / delete node go through NodePool<Node>
+#pragma once
+#include "../Pool/node_pool.h"
+
+class Node : public Pooled<Node> {
+ public:
+  int data;
+  Node *next;
+
+  Node(int x){
+      data = x;
+      next = NULL;
+  }
+};
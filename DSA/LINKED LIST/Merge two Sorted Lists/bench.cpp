@@ -0,0 +1,152 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+struct ListNode
+{
+    int val;
+    ListNode *next;
+    ListNode(int data1)
+    {
+        val = data1;
+        next = NULL;
+    }
+    ListNode(int data1, ListNode *next1)
+    {
+        val = data1;
+        next = next1;
+    }
+};
+
+#include "program.cpp"
+
+//n random ints spread over k sorted lists , nodes allocated in shuffled order so a list is
+//scattered over the heap ; the merges relink the nodes , so the lists are rebuilt before every run
+struct Lists {
+    vector<ListNode*> pool;
+    vector<vector<ListNode*>> lists;
+    Lists(int n,int k)
+    {
+        mt19937 rng(k);
+        vector<int> vals(n);
+        for(auto& x:vals)
+        {
+            x=(int)(rng()%1000000);
+        }
+        for(int i=0;i<n;i++)
+        {
+            pool.push_back(new ListNode(0));
+        }
+        vector<ListNode*> order=pool;
+        shuffle(order.begin(),order.end(),rng);
+        lists.resize(k);
+        for(int i=0;i<n;i++)
+        {
+            lists[i%k].push_back(order[i]);
+        }
+        for(int l=0;l<k;l++)
+        {
+            vector<int> part;
+            for(int i=l;i<n;i+=k)
+            {
+                part.push_back(vals[i]);
+            }
+            sort(part.begin(),part.end());
+            for(size_t i=0;i<part.size();i++)
+            {
+                lists[l][i]->val=part[i];
+            }
+        }
+    }
+    ~Lists()
+    {
+        for(auto p:pool)
+        {
+            delete p;
+        }
+    }
+    vector<ListNode*> heads()
+    {
+        vector<ListNode*> h;
+        for(auto& l:lists)
+        {
+            for(size_t i=0;i<l.size();i++)
+            {
+                l[i]->next= i+1<l.size() ? l[i+1] : nullptr;
+            }
+            h.push_back(l.empty() ? nullptr : l[0]);
+        }
+        return h;
+    }
+};
+
+//every mode has to produce the same nodes in the same order (ties -> lower list index)
+int bench(int n,const vector<int>& ks,int threads)
+{
+    Solution sol;
+    bool ok=true;
+    cout<<n<<" ints , ms , mergeKListsParallel with "<<threads<<" threads , hardware threads : "
+        <<thread::hardware_concurrency()<<endl;
+    cout<<"k     repeated mergeTwoLists    mergeKLists    mergeKListsParallel"<<endl;
+    for(int k:ks)
+    {
+        Lists in(n,k);
+        vector<ListNode*> expect;
+        double ms[3];
+        for(int mode=0;mode<3;mode++)
+        {
+            vector<ListNode*> h=in.heads();
+            auto start=chrono::steady_clock::now();
+            ListNode* out=nullptr;
+            if(mode==0)
+            {
+                //the old way : fold the lists into one , left to right
+                for(auto l:h)
+                {
+                    out=sol.mergeTwoLists(out,l);
+                }
+            }
+            else if(mode==1)
+            {
+                out=sol.mergeKLists(h);
+            }
+            else
+            {
+                out=sol.mergeKListsParallel(h,threads);
+            }
+            ms[mode]=chrono::duration<double,milli>(chrono::steady_clock::now()-start).count();
+            vector<ListNode*> got;
+            for(ListNode* p=out;p!=nullptr;p=p->next)
+            {
+                got.push_back(p);
+            }
+            if(mode==0)
+            {
+                expect=got;
+                ok=ok && (int)got.size()==n && is_sorted(got.begin(),got.end(),
+                    [](ListNode* a,ListNode* b){ return a->val<b->val; });
+            }
+            else
+            {
+                ok=ok && got==expect;
+            }
+        }
+        cout<<left<<setw(6)<<k<<right<<fixed<<setprecision(0)<<setw(14)<<ms[0]<<setw(24)<<ms[1]<<setw(18)<<ms[2]<<endl;
+    }
+    cout<<(ok ? "PASS" : "FAIL")<<" : all modes give the same node order"<<endl;
+    return ok ? 0 : 1;
+}
+
+int main(int argc,char** argv) {
+    int n= argc>=2 ? stoi(argv[1]) : 2000000;
+    int threads= argc>=3 ? stoi(argv[2]) : 4;
+    vector<int> ks;
+    for(int i=3;i<argc;i++)
+    {
+        ks.push_back(stoi(argv[i]));
+    }
+    if(ks.empty())
+    {
+        ks={2,16,256};
+    }
+    return bench(n,ks,threads);
+}
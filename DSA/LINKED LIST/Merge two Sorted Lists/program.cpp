@@ -15,6 +15,83 @@
 //     }
 // };
 
+//loser tree over k list heads : tree[0] is the winner , tree[1..k-1] hold the loser of each match
+//taking the winner's node replays only its leaf-to-root path -> log k compares per node
+//an exhausted list (head == nullptr) loses every match , ties go to the lower list index
+struct ListLoserTree {
+    int k;
+    vector<int> tree;
+    vector<ListNode*> head;
+    ListLoserTree(ListNode** lists,int count)
+    {
+        k=count;
+        head.assign(lists,lists+k);
+        tree.assign(max(k,1),0);
+        for(int i=0;i<k;i++)
+        {
+            if(head[i]!=nullptr)
+            {
+                __builtin_prefetch(head[i]->next);
+            }
+        }
+        //play the first round bottom up , leaf i sits at node k+i
+        vector<int> winner(2*k);
+        for(int i=0;i<k;i++)
+        {
+            winner[k+i]=i;
+        }
+        for(int node=k-1;node>=1;node--)
+        {
+            int a=winner[2*node];
+            int b=winner[2*node+1];
+            if(beats(a,b))
+            {
+                winner[node]=a;
+                tree[node]=b;
+            }
+            else
+            {
+                winner[node]=b;
+                tree[node]=a;
+            }
+        }
+        tree[0]= k>1 ? winner[1] : 0;
+    }
+    bool beats(int a,int b)
+    {
+        if(head[a]==nullptr) return false;
+        if(head[b]==nullptr) return true;
+        return head[a]->val<head[b]->val || (head[a]->val==head[b]->val && a<b);
+    }
+    bool empty()
+    {
+        return k==0 || head[tree[0]]==nullptr;
+    }
+    //the smallest head is unlinked from its list and returned , next is left as it was
+    ListNode* pop()
+    {
+        int w=tree[0];
+        ListNode* x=head[w];
+        ListNode* nx=x->next;
+        head[w]=nx;
+        //nx is already in cache (prefetched when x became the head) : fetch the one after it
+        if(nx!=nullptr)
+        {
+            __builtin_prefetch(nx->next);
+        }
+        //replay from the leaf of w up to the root
+        for(int node=(w+k)/2;node>=1;node/=2)
+        {
+            if(beats(tree[node],w))
+            {
+                swap(tree[node],w);
+            }
+        }
+        tree[0]=w;
+        return x;
+    }
+};
+
 class Solution {
 public:
     ListNode* mergeTwoLists(ListNode* list1, ListNode* list2) {
@@ -32,47 +109,136 @@ public:
         p2=list2;
         ListNode* p3;
         ListNode* last;
-        
-        if(p1->val<p2->val)
+
+        //last->next is overwritten by the next append , and the tail is one of the inputs' rest
+        //-> no last->next=nullptr per node
+        //ties take list1 first : stable , same order as mergeKLists (lower list index first)
+        if(p1->val<=p2->val)
         {
             p3=p1;
             last=p1;
             p1=p1->next;
-            last->next=nullptr;
         }
         else{
             p3=p2;
             last=p2;
             p2=p2->next;
-            last->next=nullptr;
         }
         while(p1!=nullptr && p2!=nullptr)
         {
-            if(p1->val<p2->val)
+            if(p1->val<=p2->val)
             {
                 last->next=p1;
                 last=p1;
                 p1=p1->next;
-                last->next=nullptr;
+                if(p1!=nullptr)
+                {
+                    __builtin_prefetch(p1->next);
+                }
             }
             else{
                 last->next=p2;
                 last=p2;
                 p2=p2->next;
-                last->next=nullptr;
+                if(p2!=nullptr)
+                {
+                    __builtin_prefetch(p2->next);
+                }
             }
 
         }
         if(p1!=nullptr)
         {
             last->next=p1;
-            
+
         }
-        if(p2!=nullptr)
+        else
         {
             last->next=p2;
-            
+
         }
         return p3;
     }
+
+    //k sorted lists in one pass : loser tree over the heads , log k compares per node
+    //nodes are relinked , not copied ; once a single list is left its rest is spliced on
+    ListNode* mergeKLists(vector<ListNode*>& lists)
+    {
+        return mergeKLists(lists.data(),lists.size());
+    }
+    ListNode* mergeKLists(ListNode** lists,int k)
+    {
+        if(k==0)
+        {
+            return nullptr;
+        }
+        if(k==1)
+        {
+            return lists[0];
+        }
+        if(k==2)
+        {
+            return mergeTwoLists(lists[0],lists[1]);
+        }
+        int live=0;
+        for(int i=0;i<k;i++)
+        {
+            live+= lists[i]!=nullptr;
+        }
+        ListLoserTree tree(lists,k);
+        ListNode* p3=nullptr;
+        ListNode* last=nullptr;
+        while(live>1)
+        {
+            ListNode* x=tree.pop();
+            if(x->next==nullptr)
+            {
+                live--;
+            }
+            if(last==nullptr)
+            {
+                p3=x;
+            }
+            else
+            {
+                last->next=x;
+            }
+            last=x;
+        }
+        //the one list left (if any) already ends in nullptr
+        ListNode* rest=tree.empty() ? nullptr : tree.head[tree.tree[0]];
+        if(last==nullptr)
+        {
+            return rest;
+        }
+        last->next=rest;
+        return p3;
+    }
+
+    //balanced merge tree over the lists : the left half on a new task , the right half on this
+    //thread , then one two-way merge of both results ; a range that gets a single thread is merged
+    //with the loser tree directly
+    ListNode* mergeKListsParallel(vector<ListNode*>& lists,int threads)
+    {
+        if(lists.empty())
+        {
+            return nullptr;
+        }
+        return mergeKListsParallel(lists.data(),lists.size(),max(threads,1));
+    }
+    ListNode* mergeKListsParallel(ListNode** lists,int k,int threads)
+    {
+        if(threads<=1 || k<=2)
+        {
+            return mergeKLists(lists,k);
+        }
+        int mid=k/2;
+        auto leftTask=async(launch::async,[=]
+        {
+            return mergeKListsParallel(lists,mid,threads/2);
+        });
+        ListNode* right=mergeKListsParallel(lists+mid,k-mid,threads-threads/2);
+        ListNode* left=leftTask.get();
+        return mergeTwoLists(left,right);
+    }
 };
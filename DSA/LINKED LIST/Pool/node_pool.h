@@ -0,0 +1,225 @@
+//node pool for the linked list solutions : slabs of nodes carved front to back ,
+//per-thread free lists , whole lists / rings handed back in O(1)
+//a freed node is linked through its own next pointer , so a list that is already
+//linked is already a free list -> releasing it is one splice , no walk
+#pragma once
+#include<algorithm>
+#include<cassert>
+#include<cstddef>
+#include<memory>
+#include<mutex>
+#include<new>
+#include<type_traits>
+#include<utility>
+#include<vector>
+
+//nodes per slab : one contiguous block , nodes allocated one after another sit side by side
+static const size_t POOL_SLAB_NODES=4096;
+//a thread keeps at most this many freed nodes , the rest goes to the shared list in one splice
+static const size_t POOL_LOCAL_MAX=16384;
+//freed segments an empty thread takes per lock : released lists may be a node or two long
+//(a run of duplicates) , one segment per lock would mean a lock on nearly every allocate
+static const size_t POOL_REFILL_SEGMENTS=64;
+
+template<class NodeT>
+class NodePool {
+public:
+    //new (pool) NodeT(args...)
+    template<class... Args>
+    static NodeT* create(Args&&... args)
+    {
+        return new(allocate()) NodeT(std::forward<Args>(args)...);
+    }
+
+    //raw storage for one NodeT : thread free list , then a shared batch , then the thread's slab
+    static void* allocate()
+    {
+        Local& local=localCache();
+        if(local.head==nullptr)
+        {
+            refill(local);
+        }
+        if(local.head!=nullptr)
+        {
+            NodeT* node=local.head;
+            local.head=node->next;
+            if(local.head==nullptr)
+            {
+                local.tail=nullptr;
+            }
+            if(local.count>0)
+            {
+                local.count--;
+            }
+            return node;
+        }
+        if(local.bump==local.bumpEnd)
+        {
+            local.bump=newSlab();
+            local.bumpEnd=local.bump+POOL_SLAB_NODES*sizeof(NodeT);
+        }
+        void* p=local.bump;
+        local.bump+=sizeof(NodeT);
+        return p;
+    }
+
+    //one node back to this thread's free list
+    static void release(NodeT* node)
+    {
+        Local& local=localCache();
+        node->next=local.head;
+        local.head=node;
+        if(local.tail==nullptr)
+        {
+            local.tail=node;
+        }
+        if(++local.count>POOL_LOCAL_MAX)
+        {
+            //surplus of a thread that frees more than it allocates (consumer side)
+            pushShared(local.head,local.tail);
+            local.head=local.tail=nullptr;
+            local.count=0;
+        }
+    }
+
+    //head -> ... -> tail (already linked by next) back to the pool in O(1)
+    //goes to the shared list : one lock per list , not per node
+    //tail->next must be nullptr : refill chains segments through it , anything after tail would be
+    //handed out as free (cut the list first , like deleteDuplicatesPooled does)
+    static void releaseList(NodeT* head,NodeT* tail)
+    {
+        if(head!=nullptr)
+        {
+            assert(tail!=nullptr && tail->next==nullptr);
+            pushShared(head,tail);
+        }
+    }
+
+    //null terminated list when the tail is not known : one walk to find it
+    static void releaseList(NodeT* head)
+    {
+        if(head==nullptr)
+        {
+            return;
+        }
+        NodeT* tail=head;
+        while(tail->next!=nullptr)
+        {
+            tail=tail->next;
+        }
+        pushShared(head,tail);
+    }
+
+    //circular list : cut right after head , head becomes the tail , O(1)
+    static void releaseRing(NodeT* head)
+    {
+        if(head==nullptr)
+        {
+            return;
+        }
+        NodeT* first=head->next;
+        head->next=nullptr;
+        pushShared(first,head);
+    }
+
+    static size_t slabCount()
+    {
+        Shared& s=shared();
+        std::lock_guard<std::mutex> lock(s.m);
+        return s.slabs.size();
+    }
+
+private:
+    static_assert(std::is_trivially_destructible<NodeT>::value,"bulk release never runs destructors");
+    static_assert(alignof(NodeT)<=__STDCPP_DEFAULT_NEW_ALIGNMENT__,"slabs come from plain new[]");
+
+    struct Segment {
+        NodeT* head;
+        NodeT* tail;
+    };
+    struct Shared {
+        std::mutex m;
+        std::vector<Segment> free;
+        std::vector<std::unique_ptr<unsigned char[]>> slabs;
+    };
+    struct Local {
+        NodeT* head=nullptr;
+        NodeT* tail=nullptr;
+        size_t count=0;
+        unsigned char* bump=nullptr;
+        unsigned char* bumpEnd=nullptr;
+        //a finished thread hands its free nodes to the others
+        ~Local()
+        {
+            if(head!=nullptr)
+            {
+                pushShared(head,tail);
+            }
+        }
+    };
+
+    static Shared& shared()
+    {
+        static Shared s;
+        return s;
+    }
+    static Local& localCache()
+    {
+        static thread_local Local local;
+        return local;
+    }
+
+    static void pushShared(NodeT* head,NodeT* tail)
+    {
+        Shared& s=shared();
+        std::lock_guard<std::mutex> lock(s.m);
+        s.free.push_back({head,tail});
+    }
+
+    //take up to POOL_REFILL_SEGMENTS freed segments (released lists or other threads' surplus)
+    //under one lock , chained tail to head into the local free list : O(1) per segment , no walk
+    static void refill(Local& local)
+    {
+        Shared& s=shared();
+        std::lock_guard<std::mutex> lock(s.m);
+        if(s.free.empty())
+        {
+            return;
+        }
+        size_t take=std::min(s.free.size(),POOL_REFILL_SEGMENTS);
+        size_t first=s.free.size()-take;
+        local.head=s.free[first].head;
+        local.tail=s.free[first].tail;
+        for(size_t i=first+1;i<s.free.size();i++)
+        {
+            local.tail->next=s.free[i].head;
+            local.tail=s.free[i].tail;
+        }
+        local.count=0;
+        s.free.resize(first);
+    }
+
+    static unsigned char* newSlab()
+    {
+        std::unique_ptr<unsigned char[]> slab(new unsigned char[POOL_SLAB_NODES*sizeof(NodeT)]);
+        unsigned char* p=slab.get();
+        Shared& s=shared();
+        std::lock_guard<std::mutex> lock(s.m);
+        s.slabs.push_back(std::move(slab));
+        return p;
+    }
+};
+
+//struct ListNode : Pooled<ListNode> { ... } -> plain new ListNode(x) / delete node go through NodePool
+template<class NodeT>
+struct Pooled {
+    static void* operator new(size_t size)
+    {
+        assert(size==sizeof(NodeT));
+        return NodePool<NodeT>::allocate();
+    }
+    static void operator delete(void* p)
+    {
+        NodePool<NodeT>::release(static_cast<NodeT*>(p));
+    }
+};
@@ -0,0 +1,235 @@
+#include<bits/stdc++.h>
+#include "node_pool.h"
+using namespace std;
+
+//every allocation gets a stamp no other allocation has : thread in the top bits , a counter below
+//a node handed out twice (or reused while still live) shows up as a stamp that changed under its owner
+struct TestNode : Pooled<TestNode> {
+    long long stamp;
+    TestNode* next;
+    TestNode(long long s) : stamp(s),next(nullptr) {}
+};
+
+static long long stampOf(int t,long long seq)
+{
+    return ((long long)t<<40)|seq;
+}
+
+//a list of len nodes , stamps first .. first+len-1 , returns the tail
+static TestNode* buildList(TestNode*& head,int len,int t,long long& seq)
+{
+    head=new TestNode(stampOf(t,seq++));
+    TestNode* tail=head;
+    for(int i=1;i<len;i++)
+    {
+        tail->next=new TestNode(stampOf(t,seq++));
+        tail=tail->next;
+    }
+    return tail;
+}
+
+//stamps must still run first , first+1 , ... along the list
+static bool checkList(TestNode* head,TestNode* tail,int len)
+{
+    long long first=head->stamp;
+    TestNode* p=head;
+    for(int i=0;i<len;i++)
+    {
+        if(p==nullptr || p->stamp!=first+i || (i==len-1)!=(p==tail))
+        {
+            return false;
+        }
+        p=p->next;
+    }
+    return true;
+}
+
+//every thread allocates and frees on its own : new / delete , lists , rings
+bool localPhase(int threads,int ops)
+{
+    atomic<bool> failed{false};
+    vector<thread> pool;
+    for(int t=0;t<threads;t++)
+    {
+        pool.emplace_back([&,t]
+        {
+            mt19937 rng(t+1);
+            long long seq=0;
+            vector<pair<TestNode*,long long>> live;
+            for(int i=0;i<ops;i++)
+            {
+                int op=rng()%8;
+                if(op<4 || live.empty())
+                {
+                    long long s=stampOf(t,seq++);
+                    live.push_back({new TestNode(s),s});
+                }
+                else if(op<7)
+                {
+                    size_t k=rng()%live.size();
+                    swap(live[k],live.back());
+                    if(live.back().first->stamp!=live.back().second)
+                    {
+                        failed=true;
+                    }
+                    delete live.back().first;
+                    live.pop_back();
+                }
+                else
+                {
+                    //a short list or ring , given back in one piece
+                    int len=1+rng()%8;
+                    TestNode* head;
+                    TestNode* tail=buildList(head,len,t,seq);
+                    if(!checkList(head,tail,len))
+                    {
+                        failed=true;
+                    }
+                    if(rng()%2)
+                    {
+                        NodePool<TestNode>::releaseList(head,tail);
+                    }
+                    else
+                    {
+                        tail->next=head;
+                        NodePool<TestNode>::releaseRing(head);
+                    }
+                }
+            }
+            for(auto& [node,s]:live)
+            {
+                if(node->stamp!=s)
+                {
+                    failed=true;
+                }
+                delete node;
+            }
+        });
+    }
+    for(auto& th:pool)
+    {
+        th.join();
+    }
+    return !failed;
+}
+
+//producers only allocate , consumers only free : whatever a producer gets back after its first slabs
+//went through the shared list (consumer surplus past POOL_LOCAL_MAX , released lists) and refill
+//returns false on a broken list , allocated = nodes handed to producers
+bool handoffPhase(int threads,int ops,long long& allocated)
+{
+    struct Batch {
+        TestNode* head;
+        TestNode* tail;
+        int len;
+    };
+    const size_t QUEUE_MAX=256;
+    mutex m;
+    condition_variable notFull,notEmpty;
+    deque<Batch> queue;
+    int producers=max(1,threads/2);
+    int consumers=max(1,threads-producers);
+    int producing=producers;
+    atomic<bool> failed{false};
+    atomic<long long> total{0};
+    vector<thread> pool;
+    for(int t=0;t<producers;t++)
+    {
+        pool.emplace_back([&,t]
+        {
+            mt19937 rng(100+t);
+            long long seq=0;
+            for(int i=0;i<ops;i++)
+            {
+                int len=1+rng()%64;
+                Batch b;
+                b.len=len;
+                b.tail=buildList(b.head,len,t,seq);
+                total+=len;
+                unique_lock<mutex> lock(m);
+                notFull.wait(lock,[&]{ return queue.size()<QUEUE_MAX; });
+                queue.push_back(b);
+                notEmpty.notify_one();
+            }
+            lock_guard<mutex> lock(m);
+            if(--producing==0)
+            {
+                notEmpty.notify_all();
+            }
+        });
+    }
+    for(int t=0;t<consumers;t++)
+    {
+        pool.emplace_back([&,t]
+        {
+            mt19937 rng(200+t);
+            while(true)
+            {
+                Batch b;
+                {
+                    unique_lock<mutex> lock(m);
+                    notEmpty.wait(lock,[&]{ return !queue.empty() || producing==0; });
+                    if(queue.empty())
+                    {
+                        return;
+                    }
+                    b=queue.front();
+                    queue.pop_front();
+                    notFull.notify_one();
+                }
+                if(!checkList(b.head,b.tail,b.len))
+                {
+                    failed=true;
+                    continue;
+                }
+                if(rng()%2)
+                {
+                    NodePool<TestNode>::releaseList(b.head,b.tail);
+                }
+                else
+                {
+                    //node by node : the consumer's free list grows until it spills to the shared list
+                    for(TestNode* p=b.head;p!=nullptr;)
+                    {
+                        TestNode* where_next=p->next;
+                        delete p;
+                        p=where_next;
+                    }
+                }
+            }
+        });
+    }
+    for(auto& th:pool)
+    {
+        th.join();
+    }
+    allocated=total;
+    return !failed;
+}
+
+int stressTest(int threads,int ops)
+{
+    bool ok=localPhase(threads,ops);
+    cout<<(ok ? "PASS" : "FAIL")<<" : local , "<<threads<<" threads x "<<ops<<" ops"<<endl;
+    size_t slabsBefore=NodePool<TestNode>::slabCount();
+    long long allocated=0;
+    bool handoff=handoffPhase(threads,ops/8,allocated);
+    size_t slabs=NodePool<TestNode>::slabCount()-slabsBefore;
+    //without reuse every node would need fresh slab space ; the queue bounds the live nodes ,
+    //so nearly all of them have to come back through refill
+    bool reused=slabs*POOL_SLAB_NODES*4<(size_t)allocated;
+    cout<<(handoff && reused ? "PASS" : "FAIL")<<" : handoff , "<<allocated<<" nodes allocated , "
+        <<slabs<<" new slabs ("<<slabs*POOL_SLAB_NODES<<" nodes)"<<endl;
+    return ok && handoff && reused ? 0 : 1;
+}
+
+int main(int argc,char** argv) {
+    int threads= argc>=2 ? stoi(argv[1]) : 8;
+    int ops= argc>=3 ? stoi(argv[2]) : 200000;
+    if(threads<1 || ops<8)
+    {
+        cerr<<"usage: "<<argv[0]<<" [threads=8] [ops per thread=200000]"<<endl;
+        return 1;
+    }
+    return stressTest(threads,ops);
+}
@@ -1,3 +1,5 @@
+#include "../Pool/node_pool.h"
+
 /**
  * Definition for singly-linked list.
  * struct ListNode {
@@ -7,6 +9,8 @@
  *     ListNode(int x) : val(x), next(nullptr) {}
  *     ListNode(int x, ListNode *next) : val(x), next(next) {}
  * };
+ * pooled nodes : struct ListNode : Pooled<ListNode> { ... } (../Pool/node_pool.h)
+ * -> the delete below goes to the per-thread pool instead of free()
  */
 class Solution {
 public:
@@ -34,4 +38,29 @@ public:
         }
         return head;
     }
+    //same walk for pooled nodes , but a run of duplicates is cut out as one piece
+    //and handed back to the pool in a single splice instead of one delete per node
+    template<class NodeT>
+    NodeT* deleteDuplicatesPooled(NodeT* head)
+    {
+        static_assert(is_base_of<Pooled<NodeT>,NodeT>::value,"nodes must come from NodePool");
+        NodeT* p=head;
+        while(p!=nullptr && p->next!=nullptr)
+        {
+            NodeT* last=p;
+            while(last->next!=nullptr && last->next->val==p->val)
+            {
+                last=last->next;
+            }
+            if(last!=p)
+            {
+                NodeT* first=p->next;
+                p->next=last->next;
+                last->next=nullptr;
+                NodePool<NodeT>::releaseList(first,last);
+            }
+            p=p->next;
+        }
+        return head;
+    }
 };
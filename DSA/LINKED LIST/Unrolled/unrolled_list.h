@@ -0,0 +1,439 @@
+//unrolled linked list : every node (block) holds up to B values in a small array ,
+//so a traversal pays one pointer chase per B values instead of one per value
+//blocks come from NodePool (../Pool/node_pool.h) , clear() gives them all back in O(1)
+//ported operations : reverse , merge of two sorted lists , sorted duplicate removal ,
+//sorted insert , key deletion
+#pragma once
+#include "../Pool/node_pool.h"
+#include<algorithm>
+#include<cstddef>
+#include<cstdint>
+#include<cstring>
+#include<iterator>
+#include<type_traits>
+#include<utility>
+
+template<class T=int,size_t B=32>
+class UnrolledList {
+    static_assert(B>=2 && B<=256,"block size out of range");
+    static_assert(std::is_trivially_copyable<T>::value,"values are moved with memmove");
+
+    struct Block {
+        Block* next;
+        uint32_t count;
+        T v[B];
+    };
+
+public:
+    class const_iterator {
+    public:
+        using iterator_category=std::forward_iterator_tag;
+        using value_type=T;
+        using difference_type=std::ptrdiff_t;
+        using pointer=const T*;
+        using reference=const T&;
+
+        const_iterator() : b(nullptr),i(0) {}
+        reference operator*() const { return b->v[i]; }
+        pointer operator->() const { return &b->v[i]; }
+        const_iterator& operator++()
+        {
+            if(++i==b->count)
+            {
+                b=b->next;
+                i=0;
+            }
+            return *this;
+        }
+        const_iterator operator++(int) { const_iterator t=*this; ++*this; return t; }
+        bool operator==(const const_iterator& o) const { return b==o.b && i==o.i; }
+        bool operator!=(const const_iterator& o) const { return !(*this==o); }
+
+    private:
+        friend class UnrolledList;
+        const_iterator(const Block* b_,uint32_t i_) : b(b_),i(i_) {}
+        const Block* b;
+        uint32_t i;
+    };
+
+    UnrolledList() : head(nullptr),tail(nullptr),n(0) {}
+    UnrolledList(const UnrolledList&)=delete;
+    UnrolledList& operator=(const UnrolledList&)=delete;
+    UnrolledList(UnrolledList&& o) noexcept : head(o.head),tail(o.tail),n(o.n)
+    {
+        o.head=o.tail=nullptr;
+        o.n=0;
+    }
+    UnrolledList& operator=(UnrolledList&& o) noexcept
+    {
+        if(this!=&o)
+        {
+            clear();
+            head=o.head;
+            tail=o.tail;
+            n=o.n;
+            o.head=o.tail=nullptr;
+            o.n=0;
+        }
+        return *this;
+    }
+    ~UnrolledList() { clear(); }
+
+    size_t size() const { return n; }
+    bool empty() const { return n==0; }
+    const_iterator begin() const { return const_iterator(head,0); }
+    const_iterator end() const { return const_iterator(); }
+
+    //every block back to the pool in one splice
+    void clear()
+    {
+        NodePool<Block>::releaseList(head,tail);
+        head=tail=nullptr;
+        n=0;
+    }
+
+    void push_back(const T& x)
+    {
+        if(tail==nullptr || tail->count==B)
+        {
+            appendBlock(newBlock());
+        }
+        tail->v[tail->count++]=x;
+        n++;
+    }
+
+    //f(value) for every value , block by block (tight inner loop over a plain array)
+    template<class F>
+    void forEach(F f) const
+    {
+        for(const Block* b=head;b!=nullptr;b=b->next)
+        {
+            for(uint32_t i=0;i<b->count;i++)
+            {
+                f(b->v[i]);
+            }
+        }
+    }
+
+    //reverseList : flip the block chain , then the values inside every block
+    void reverse()
+    {
+        tail=head;
+        Block* q=nullptr;
+        Block* p=head;
+        while(p!=nullptr)
+        {
+            Block* where_next=p->next;
+            std::reverse(p->v,p->v+p->count);
+            p->next=q;
+            q=p;
+            p=where_next;
+        }
+        head=q;
+    }
+
+    //mergeTwoLists : both inputs are consumed (left empty) , like the node version relinks them
+    //values are packed into the drained input blocks , so the merge allocates only the
+    //one or two blocks needed before the first input block runs dry ;
+    //once one side runs out , the other side's untouched blocks are spliced on as they are
+    //stable : on equal values the one from a goes first
+    static UnrolledList mergeSorted(UnrolledList& a,UnrolledList& b)
+    {
+        UnrolledList out;
+        out.n=a.n+b.n;
+        Block* pa=a.head;
+        Block* pb=b.head;
+        Block* ta=a.tail;
+        Block* tb=b.tail;
+        uint32_t ia=0,ib=0;
+        a.head=a.tail=b.head=b.tail=nullptr;
+        a.n=b.n=0;
+
+        //drained blocks waiting to be reused as output blocks
+        Block* spare=nullptr;
+        Block* w=nullptr;
+        auto nextOut=[&]()
+        {
+            Block* blk=spare;
+            if(blk==nullptr)
+            {
+                blk=newBlock();
+            }
+            else
+            {
+                spare=spare->next;
+                blk->count=0;
+            }
+            out.appendBlock(blk);
+            w=blk;
+        };
+        auto put=[&](const T& x)
+        {
+            if(w==nullptr || w->count==B)
+            {
+                nextOut();
+            }
+            w->v[w->count++]=x;
+        };
+        //a block is recycled only after its last value was read
+        auto drained=[&](Block*& p,uint32_t& i)
+        {
+            Block* nx=p->next;
+            p->next=spare;
+            spare=p;
+            p=nx;
+            i=0;
+        };
+        while(pa!=nullptr && pb!=nullptr)
+        {
+            if(w==nullptr || w->count==B)
+            {
+                nextOut();
+            }
+            //no block boundary can be crossed within this many steps ,
+            //so the inner loop is a plain branch-free array merge
+            uint32_t steps=std::min(std::min(pa->count-ia,pb->count-ib),static_cast<uint32_t>(B)-w->count);
+            const T* va=pa->v;
+            const T* vb=pb->v;
+            uint32_t i1=ia,i2=ib;
+            T* o=w->v+w->count;
+            for(uint32_t k=0;k<steps;k++)
+            {
+                const T x=va[i1];
+                const T y=vb[i2];
+                bool takeA=!(y<x);
+                o[k]=takeA ? x : y;
+                i1+=takeA;
+                i2+=!takeA;
+            }
+            ia=i1;
+            ib=i2;
+            w->count+=steps;
+            if(ia==pa->count)
+            {
+                drained(pa,ia);
+            }
+            if(ib==pb->count)
+            {
+                drained(pb,ib);
+            }
+        }
+        Block* p=(pa!=nullptr) ? pa : pb;
+        Block* last=(pa!=nullptr) ? ta : tb;
+        uint32_t i=(pa!=nullptr) ? ia : ib;
+        if(p!=nullptr && i==0)
+        {
+            //nothing read from it yet : the whole remainder is spliced
+            if(out.tail==nullptr)
+            {
+                out.head=p;
+            }
+            else
+            {
+                out.tail->next=p;
+            }
+            out.tail=last;
+        }
+        else if(p!=nullptr)
+        {
+            //rest of the partly read block by value , every block after it by splice
+            for(;i<p->count;i++)
+            {
+                put(p->v[i]);
+            }
+            Block* rest=p->next;
+            p->next=spare;
+            spare=p;
+            if(rest!=nullptr)
+            {
+                out.tail->next=rest;
+                out.tail=last;
+            }
+        }
+        NodePool<Block>::releaseList(spare);
+        return out;
+    }
+
+    //deleteDuplicates on a sorted list : one compaction pass , a write cursor trails the read cursor ,
+    //blocks emptied at the end go back to the pool in one splice
+    void removeSortedDuplicates()
+    {
+        if(head==nullptr)
+        {
+            return;
+        }
+        Block* wb=head;
+        uint32_t wi=1;
+        for(Block* rb=head;rb!=nullptr;rb=rb->next)
+        {
+            for(uint32_t i=(rb==head) ? 1 : 0;i<rb->count;i++)
+            {
+                const T x=rb->v[i];
+                const T& last=wb->v[wi-1];
+                if(!(last<x) && !(x<last))
+                {
+                    continue;
+                }
+                if(wi==wb->count)
+                {
+                    //block full up to its old size : continue in the next one
+                    //(the write cursor never passes the read cursor)
+                    wb=wb->next;
+                    wb->v[0]=x;
+                    wi=1;
+                    continue;
+                }
+                wb->v[wi++]=x;
+            }
+        }
+        //wb keeps wi values , everything after wb is unused
+        size_t kept=0;
+        for(Block* b=head;b!=wb;b=b->next)
+        {
+            kept+=b->count;
+        }
+        wb->count=wi;
+        kept+=wi;
+        NodePool<Block>::releaseList(wb->next,tail);
+        wb->next=nullptr;
+        tail=wb;
+        n=kept;
+    }
+
+    //sortedInsert : skip whole blocks by their last value , insert inside the block ,
+    //a full block is split in two halves (neighbouring values stay together)
+    void sortedInsert(const T& x)
+    {
+        if(head==nullptr)
+        {
+            push_back(x);
+            return;
+        }
+        Block* b=head;
+        while(b->next!=nullptr && b->v[b->count-1]<x)
+        {
+            b=b->next;
+        }
+        uint32_t pos=static_cast<uint32_t>(std::upper_bound(b->v,b->v+b->count,x)-b->v);
+        if(b->count==B)
+        {
+            Block* nb=split(b);
+            if(pos>b->count)
+            {
+                pos-=b->count;
+                b=nb;
+            }
+        }
+        std::memmove(b->v+pos+1,b->v+pos,(b->count-pos)*sizeof(T));
+        b->v[pos]=x;
+        b->count++;
+        n++;
+    }
+
+    //deleteNode : first value equal to key is removed , false if there is none
+    //a block under half full borrows from / merges with its successor
+    bool erase(const T& key)
+    {
+        Block* prev=nullptr;
+        for(Block* b=head;b!=nullptr;prev=b,b=b->next)
+        {
+            T* it=std::find(b->v,b->v+b->count,key);
+            if(it==b->v+b->count)
+            {
+                continue;
+            }
+            uint32_t pos=static_cast<uint32_t>(it-b->v);
+            std::memmove(b->v+pos,b->v+pos+1,(b->count-pos-1)*sizeof(T));
+            b->count--;
+            n--;
+            if(b->count==0)
+            {
+                unlink(prev,b);
+            }
+            else if(b->count<B/2 && b->next!=nullptr && b->count+b->next->count<=B)
+            {
+                Block* nx=b->next;
+                std::memcpy(b->v+b->count,nx->v,nx->count*sizeof(T));
+                b->count+=nx->count;
+                unlink(b,nx);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    //sorted lookup : skip blocks by their last value , binary search inside one
+    bool containsSorted(const T& key) const
+    {
+        for(const Block* b=head;b!=nullptr;b=b->next)
+        {
+            if(b->v[b->count-1]<key)
+            {
+                continue;
+            }
+            return std::binary_search(b->v,b->v+b->count,key);
+        }
+        return false;
+    }
+
+private:
+    Block* head;
+    Block* tail;
+    size_t n;
+
+    static Block* newBlock()
+    {
+        Block* b=static_cast<Block*>(NodePool<Block>::allocate());
+        b->next=nullptr;
+        b->count=0;
+        return b;
+    }
+
+    void appendBlock(Block* b)
+    {
+        b->next=nullptr;
+        if(tail==nullptr)
+        {
+            head=b;
+        }
+        else
+        {
+            tail->next=b;
+        }
+        tail=b;
+    }
+
+    //upper half of a full block moves to a new block right after it
+    Block* split(Block* b)
+    {
+        Block* nb=newBlock();
+        uint32_t half=b->count/2;
+        nb->count=b->count-half;
+        std::memcpy(nb->v,b->v+half,nb->count*sizeof(T));
+        b->count=half;
+        nb->next=b->next;
+        b->next=nb;
+        if(tail==b)
+        {
+            tail=nb;
+        }
+        return nb;
+    }
+
+    void unlink(Block* prev,Block* b)
+    {
+        if(prev==nullptr)
+        {
+            head=b->next;
+        }
+        else
+        {
+            prev->next=b->next;
+        }
+        if(tail==b)
+        {
+            tail=prev;
+        }
+        NodePool<Block>::release(b);
+    }
+};
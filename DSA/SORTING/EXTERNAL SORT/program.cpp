@@ -0,0 +1,433 @@
+#include<bits/stdc++.h>
+#include "../MERGE SORT/merge_sort.h"
+using namespace std;
+
+//buffered sequential reader over a binary file of ints
+//failed : the file did not open or a read error hit -> next() stops , the caller must check
+struct RunReader {
+    FILE* f=nullptr;
+    vector<int> buf;
+    size_t pos=0;
+    size_t len=0;
+    bool failed=false;
+    RunReader(const string& path,size_t bufInts)
+    {
+        f=fopen(path.c_str(),"rb");
+        failed= f==nullptr;
+        buf.resize(max<size_t>(bufInts,1));
+    }
+    ~RunReader()
+    {
+        if(f)
+        {
+            fclose(f);
+        }
+    }
+    bool next(int& x)
+    {
+        if(pos==len)
+        {
+            if(failed)
+            {
+                return false;
+            }
+            len=fread(buf.data(),sizeof(int),buf.size(),f);
+            pos=0;
+            if(len<buf.size() && ferror(f))
+            {
+                failed=true;
+                len=0;
+            }
+            if(len==0)
+            {
+                return false;
+            }
+        }
+        x=buf[pos++];
+        return true;
+    }
+};
+
+//buffered sequential writer , one fwrite per full buffer
+//failed : open , a short fwrite or fclose went wrong ; close() reports it , the destructor cannot
+struct RunWriter {
+    FILE* f=nullptr;
+    vector<int> buf;
+    size_t len=0;
+    bool failed=false;
+    RunWriter(const string& path,size_t bufInts)
+    {
+        f=fopen(path.c_str(),"wb");
+        failed= f==nullptr;
+        buf.resize(max<size_t>(bufInts,1));
+    }
+    ~RunWriter()
+    {
+        close();
+    }
+    void push(int x)
+    {
+        buf[len++]=x;
+        if(len==buf.size())
+        {
+            flush();
+        }
+    }
+    //bulk write past the buffer
+    void write(const int* data,size_t count)
+    {
+        flush();
+        if(f && count>0 && fwrite(data,sizeof(int),count,f)!=count)
+        {
+            failed=true;
+        }
+    }
+    void flush()
+    {
+        if(f && len>0 && fwrite(buf.data(),sizeof(int),len,f)!=len)
+        {
+            failed=true;
+        }
+        len=0;
+    }
+    //true if every int reached the file
+    bool close()
+    {
+        if(f)
+        {
+            flush();
+            if(fflush(f)!=0 || ferror(f))
+            {
+                failed=true;
+            }
+            if(fclose(f)!=0)
+            {
+                failed=true;
+            }
+            f=nullptr;
+        }
+        return !failed;
+    }
+};
+
+//loser tree over k runs : tree[0] is the winner , tree[1..k-1] hold the loser of each match
+//replacing the winner replays only its leaf-to-root path -> log k compares per element
+struct LoserTree {
+    int k;
+    vector<int> tree;
+    vector<int> key;
+    vector<char> done;
+    vector<RunReader*> runs;
+    LoserTree(vector<RunReader*>& readers)
+    {
+        runs=readers;
+        k=runs.size();
+        key.assign(k,0);
+        done.assign(k,0);
+        for(int i=0;i<k;i++)
+        {
+            done[i]=!runs[i]->next(key[i]);
+        }
+        tree.assign(max(k,1),0);
+        //play the first round bottom up , leaf i sits at node k+i
+        vector<int> winner(2*k);
+        for(int i=0;i<k;i++)
+        {
+            winner[k+i]=i;
+        }
+        for(int node=k-1;node>=1;node--)
+        {
+            int a=winner[2*node];
+            int b=winner[2*node+1];
+            if(beats(a,b))
+            {
+                winner[node]=a;
+                tree[node]=b;
+            }
+            else
+            {
+                winner[node]=b;
+                tree[node]=a;
+            }
+        }
+        tree[0]= k>1 ? winner[1] : 0;
+    }
+    //exhausted runs lose every match , ties go to the lower run index
+    bool beats(int a,int b)
+    {
+        if(done[a]) return false;
+        if(done[b]) return true;
+        return key[a]<key[b] || (key[a]==key[b] && a<b);
+    }
+    bool empty()
+    {
+        return k==0 || done[tree[0]];
+    }
+    int pop()
+    {
+        int w=tree[0];
+        int x=key[w];
+        done[w]=!runs[w]->next(key[w]);
+        //replay from the leaf of w up to the root
+        for(int node=(w+k)/2;node>=1;node/=2)
+        {
+            if(beats(tree[node],w))
+            {
+                swap(tree[node],w);
+            }
+        }
+        tree[0]=w;
+        return x;
+    }
+};
+
+class Solution {
+public:
+    //smallest read / write buffer of a merge : more runs than the budget has buffers for are
+    //merged in several passes , fanIn runs at a time into longer runs
+    static const size_t MERGE_BUF_INTS=1024;
+
+    //sorts a binary file of ints that does not fit in memory
+    //phase 1 : cut it into memoryBudget sized runs , sort each with the ping-pong merge sort
+    //(../MERGE SORT/merge_sort.h) , spill to temp files
+    //phase 2 : one k-way merge of all runs through a loser tree
+    bool externalSort(const string& inPath,const string& outPath,size_t memoryBudget,const string& tmpDir)
+    {
+        //run array + its merge workspace have to fit in the budget
+        size_t runInts=max<size_t>(memoryBudget/(2*sizeof(int)),1024);
+        FILE* in=fopen(inPath.c_str(),"rb");
+        if(!in)
+        {
+            cerr<<"cannot open "<<inPath<<endl;
+            return false;
+        }
+        //fread in whole ints would drop a trailing partial one without a word
+        error_code ec;
+        uintmax_t bytes=filesystem::file_size(inPath,ec);
+        if(!ec && bytes%sizeof(int)!=0)
+        {
+            cerr<<inPath<<" : "<<bytes<<" bytes is not a whole number of ints"<<endl;
+            fclose(in);
+            return false;
+        }
+        vector<string> runFiles;
+        vector<int> chunk(runInts);
+        vector<int> workspace;
+        while(true)
+        {
+            size_t got=fread(chunk.data(),sizeof(int),runInts,in);
+            if(got==0)
+            {
+                break;
+            }
+            chunk.resize(got);
+            pingPongMergeSort(chunk,workspace);
+            string path=runPath(tmpDir,runFiles.size());
+            runFiles.push_back(path);
+            RunWriter w(path,0);
+            w.write(chunk.data(),got);
+            if(!w.close())
+            {
+                cerr<<"cannot write "<<path<<endl;
+                fclose(in);
+                removeRuns(runFiles);
+                return false;
+            }
+            chunk.resize(runInts);
+        }
+        bool readError=ferror(in)!=0;
+        fclose(in);
+        if(readError)
+        {
+            cerr<<"cannot read "<<inPath<<endl;
+            removeRuns(runFiles);
+            return false;
+        }
+        //give the memory back before the merge phase
+        vector<int>().swap(chunk);
+        vector<int>().swap(workspace);
+
+        //k read buffers + one write buffer of at least MERGE_BUF_INTS each
+        size_t fanIn=max<size_t>(memoryBudget/(MERGE_BUF_INTS*sizeof(int)),3)-1;
+        size_t seq=runFiles.size();
+        while(runFiles.size()>fanIn)
+        {
+            vector<string> next;
+            for(size_t g=0;g<runFiles.size();g+=fanIn)
+            {
+                size_t stop=min(g+fanIn,runFiles.size());
+                if(stop-g==1)
+                {
+                    next.push_back(runFiles[g]);
+                    continue;
+                }
+                vector<string> group(runFiles.begin()+g,runFiles.begin()+stop);
+                next.push_back(runPath(tmpDir,seq++));
+                bool ok=kWayMerge(group,next.back(),memoryBudget);
+                removeRuns(group);
+                if(!ok)
+                {
+                    //the merged runs of this pass and the groups not reached yet
+                    vector<string> rest(runFiles.begin()+stop,runFiles.end());
+                    removeRuns(rest);
+                    removeRuns(next);
+                    return false;
+                }
+            }
+            runFiles.swap(next);
+        }
+        bool ok=kWayMerge(runFiles,outPath,memoryBudget);
+        removeRuns(runFiles);
+        return ok;
+    }
+    string runPath(const string& tmpDir,size_t index)
+    {
+        return tmpDir+"/run_"+to_string(getpid())+"_"+to_string(index)+".bin";
+    }
+    void removeRuns(vector<string>& runFiles)
+    {
+        for(auto& path:runFiles)
+        {
+            remove(path.c_str());
+        }
+    }
+    //budget is shared by k read buffers + one write buffer , all read sequentially
+    //externalSort keeps k small enough that every buffer gets MERGE_BUF_INTS or more
+    bool kWayMerge(vector<string>& runFiles,const string& outPath,size_t memoryBudget)
+    {
+        int k=runFiles.size();
+        size_t bufInts=max<size_t>(memoryBudget/((k+1)*sizeof(int)),MERGE_BUF_INTS);
+        vector<RunReader*> readers;
+        bool ok=true;
+        for(auto& path:runFiles)
+        {
+            readers.push_back(new RunReader(path,bufInts));
+            if(readers.back()->failed)
+            {
+                //a missing run would silently drop its ints from the output
+                cerr<<"cannot open "<<path<<endl;
+                ok=false;
+            }
+        }
+        if(ok)
+        {
+            RunWriter out(outPath,bufInts);
+            if(out.failed)
+            {
+                cerr<<"cannot write "<<outPath<<endl;
+                ok=false;
+            }
+            else
+            {
+                LoserTree tree(readers);
+                while(!tree.empty() && !out.failed)
+                {
+                    out.push(tree.pop());
+                }
+                for(auto r:readers)
+                {
+                    if(r->failed)
+                    {
+                        cerr<<"read error in a run file"<<endl;
+                        ok=false;
+                    }
+                }
+                if(!out.close())
+                {
+                    cerr<<"cannot write "<<outPath<<endl;
+                    ok=false;
+                }
+            }
+        }
+        for(auto r:readers)
+        {
+            delete r;
+        }
+        return ok;
+    }
+};
+
+//writes n random ints , sorts them with the given budget , checks against std::sort
+bool sortCheck(const string& tmpDir,size_t n,size_t budget)
+{
+    string inPath=tmpDir+"/selftest_in.bin";
+    string outPath=tmpDir+"/selftest_out.bin";
+    mt19937 rng(12345);
+    vector<int> data(n);
+    for(auto& x:data)
+    {
+        x=(int)rng();
+    }
+    {
+        RunWriter w(inPath,1<<16);
+        w.write(data.data(),n);
+        if(!w.close())
+        {
+            cout<<"FAIL : cannot write "<<inPath<<endl;
+            return false;
+        }
+    }
+    Solution sol;
+    bool ok=sol.externalSort(inPath,outPath,budget,tmpDir);
+    sort(data.begin(),data.end());
+    vector<int> got(n+1);
+    FILE* f=fopen(outPath.c_str(),"rb");
+    size_t len= f ? fread(got.data(),sizeof(int),n+1,f) : 0;
+    if(f)
+    {
+        fclose(f);
+    }
+    got.resize(len);
+    remove(inPath.c_str());
+    remove(outPath.c_str());
+    ok=ok && got==data;
+    size_t runs=(n+budget/(2*sizeof(int))-1)/(budget/(2*sizeof(int)));
+    cout<<(ok ? "PASS" : "FAIL")<<" : "<<n<<" ints , budget "<<budget<<" bytes , "<<runs<<" runs"<<endl;
+    return ok;
+}
+
+//budget 4x smaller than the file : one merge pass
+//budget 64 KB : 512 runs , fan-in 15 -> several merge passes
+//plus a file that ends in a partial int , which has to be an error
+int selfTest(const string& tmpDir)
+{
+    size_t n=1<<22;
+    bool ok=sortCheck(tmpDir,n,n*sizeof(int)/4);
+    ok=sortCheck(tmpDir,n,64<<10) && ok;
+    string inPath=tmpDir+"/selftest_in.bin";
+    string outPath=tmpDir+"/selftest_out.bin";
+    FILE* g=fopen(inPath.c_str(),"wb");
+    int one=1;
+    bool wrote= g && fwrite(&one,sizeof(int),1,g)==1 && fputc(0,g)!=EOF;
+    if(g)
+    {
+        fclose(g);
+    }
+    Solution sol;
+    bool rejected= wrote && !sol.externalSort(inPath,outPath,1<<20,tmpDir);
+    remove(inPath.c_str());
+    remove(outPath.c_str());
+    cout<<(rejected ? "PASS" : "FAIL")<<" : partial trailing int rejected"<<endl;
+    return ok && rejected ? 0 : 1;
+}
+
+int main(int argc,char** argv) {
+    string tmpDir=filesystem::temp_directory_path().string();
+    if(argc>=2 && string(argv[1])=="--selftest")
+    {
+        return selfTest(argc>=3 ? argv[2] : tmpDir);
+    }
+    if(argc<3)
+    {
+        cerr<<"usage: "<<argv[0]<<" <input.bin> <output.bin> [budgetMB=256] [tmpDir]"<<endl;
+        cerr<<"       "<<argv[0]<<" --selftest [tmpDir]"<<endl;
+        return 1;
+    }
+    size_t budgetMB= argc>=4 ? stoul(argv[3]) : 256;
+    if(argc>=5)
+    {
+        tmpDir=argv[4];
+    }
+    Solution sol;
+    return sol.externalSort(argv[1],argv[2],budgetMB<<20,tmpDir) ? 0 : 1;
+}
@@ -0,0 +1,345 @@
+//header-only versions of bubbleSort , selectionSort , quickSort , mergeSort
+//over any random-access range , with a comparator and a projection
+//sorting::quickSort(v.begin(),v.end());                                 //like the int Solution
+//sorting::mergeSort(v.begin(),v.end(),greater<>());                      //descending
+//sorting::quickSort(v.begin(),v.end(),less<>(),&Order::id);              //structs by key
+#pragma once
+#include<algorithm>
+#include<functional>
+#include<iterator>
+#include<type_traits>
+#include<utility>
+#include<vector>
+
+namespace sorting {
+
+//default projection : the element itself
+struct identity {
+    template<class T>
+    constexpr T&& operator()(T&& t) const noexcept
+    {
+        return std::forward<T>(t);
+    }
+};
+
+namespace detail {
+
+//small trivially copyable values (ints , floats , 64-bit ids , small PODs) get the branch-light kernels
+//wide or non-trivial records get the move-based ones
+template<class T>
+constexpr bool branchLight=std::is_trivially_copyable_v<T> && sizeof(T)<=2*sizeof(void*);
+
+//comp applied to projected values
+template<class Comp,class Proj>
+struct Less {
+    Comp& comp;
+    Proj& proj;
+    template<class A,class B>
+    bool operator()(A&& a,B&& b) const
+    {
+        return std::invoke(comp,std::invoke(proj,std::forward<A>(a)),std::invoke(proj,std::forward<B>(b)));
+    }
+};
+
+template<class It,class L>
+void insertionSort(It first,It last,L less)
+{
+    if(first==last)
+    {
+        return;
+    }
+    for(It i=first+1;i!=last;++i)
+    {
+        auto key=std::move(*i);
+        It j=i;
+        while(j!=first && less(key,*(j-1)))
+        {
+            *j=std::move(*(j-1));
+            --j;
+        }
+        *j=std::move(key);
+    }
+}
+
+template<class It,class L>
+It medianOfThree(It a,It b,It c,L less)
+{
+    if(less(*a,*b))
+    {
+        if(less(*b,*c)) return b;
+        return less(*a,*c) ? c : a;
+    }
+    if(less(*a,*c)) return a;
+    return less(*b,*c) ? c : b;
+}
+
+//moves the chosen pivot to *first (ninther above 128 elements)
+template<class It,class L>
+void choosePivot(It first,It last,L less)
+{
+    auto n=last-first;
+    It mid=first+n/2;
+    It high=last-1;
+    It m;
+    if(n>128)
+    {
+        auto s=n/8;
+        It m1=medianOfThree(first,first+s,first+2*s,less);
+        It m2=medianOfThree(mid-s,mid,mid+s,less);
+        It m3=medianOfThree(high-2*s,high-s,high,less);
+        m=medianOfThree(m1,m2,m3,less);
+    }
+    else
+    {
+        m=medianOfThree(first,mid,high,less);
+    }
+    std::iter_swap(first,m);
+}
+
+//pivot is *first , both pointers stop on equal keys
+template<class It,class L>
+It balancedPartition(It first,It last,L less)
+{
+    It left=first+1;
+    It right=last-1;
+    while(true)
+    {
+        while(left<=right && less(*left,*first))
+        {
+            ++left;
+        }
+        while(left<=right && less(*first,*right))
+        {
+            --right;
+        }
+        if(left>=right)
+        {
+            break;
+        }
+        std::iter_swap(left,right);
+        ++left;
+        --right;
+    }
+    std::iter_swap(first,right);
+    return right;
+}
+
+template<class It,class L>
+void siftDown(It base,std::ptrdiff_t i,std::ptrdiff_t n,L less)
+{
+    auto val=std::move(base[i]);
+    while(2*i+1<n)
+    {
+        std::ptrdiff_t child=2*i+1;
+        if(child+1<n && less(base[child],base[child+1]))
+        {
+            child++;
+        }
+        if(!less(val,base[child]))
+        {
+            break;
+        }
+        base[i]=std::move(base[child]);
+        i=child;
+    }
+    base[i]=std::move(val);
+}
+
+template<class It,class L>
+void heapSort(It first,It last,L less)
+{
+    std::ptrdiff_t n=last-first;
+    for(std::ptrdiff_t i=n/2-1;i>=0;i--)
+    {
+        siftDown(first,i,n,less);
+    }
+    for(std::ptrdiff_t end=n-1;end>0;end--)
+    {
+        std::iter_swap(first,first+end);
+        siftDown(first,0,end,less);
+    }
+}
+
+constexpr std::ptrdiff_t INSERTION_CUTOFF=16;
+
+template<class It,class L>
+void introSortLoop(It first,It last,int depthLimit,L less)
+{
+    while(last-first>INSERTION_CUTOFF)
+    {
+        if(depthLimit==0)
+        {
+            heapSort(first,last,less);
+            return;
+        }
+        depthLimit--;
+        choosePivot(first,last,less);
+        It pivot=balancedPartition(first,last,less);
+        //smaller side recursive , bigger side looped
+        if(pivot-first<last-pivot)
+        {
+            introSortLoop(first,pivot,depthLimit,less);
+            first=pivot+1;
+        }
+        else
+        {
+            introSortLoop(pivot+1,last,depthLimit,less);
+            last=pivot;
+        }
+    }
+    insertionSort(first,last,less);
+}
+
+//merges a[lo..mid) and a[mid..hi) into out[lo..hi) , moving elements
+template<class Src,class Dst,class L>
+void mergeInto(Src a,Dst out,std::ptrdiff_t lo,std::ptrdiff_t mid,std::ptrdiff_t hi,L less)
+{
+    using T=typename std::iterator_traits<Src>::value_type;
+    std::ptrdiff_t left=lo;
+    std::ptrdiff_t right=mid;
+    std::ptrdiff_t k=lo;
+    if constexpr(branchLight<T>)
+    {
+        //no unpredictable branch : both candidates are loaded , the compare picks one
+        while(left<mid && right<hi)
+        {
+            bool takeRight=less(a[right],a[left]);
+            out[k++]=takeRight ? a[right] : a[left];
+            right+=takeRight;
+            left+=!takeRight;
+        }
+    }
+    else
+    {
+        while(left<mid && right<hi)
+        {
+            if(less(a[right],a[left]))
+            {
+                out[k++]=std::move(a[right++]);
+            }
+            else
+            {
+                out[k++]=std::move(a[left++]);
+            }
+        }
+    }
+    std::move(a+left,a+mid,out+k);
+    std::move(a+right,a+hi,out+k+(mid-left));
+}
+
+template<class A,class B,class L>
+void sortTo(A src,B dst,std::ptrdiff_t lo,std::ptrdiff_t hi,L less);
+
+//sorts a[lo..hi) in place , tmp is scratch
+template<class A,class B,class L>
+void sortInPlace(A a,B tmp,std::ptrdiff_t lo,std::ptrdiff_t hi,L less)
+{
+    if(hi-lo<=INSERTION_CUTOFF)
+    {
+        insertionSort(a+lo,a+hi,less);
+        return;
+    }
+    std::ptrdiff_t mid=lo+(hi-lo)/2;
+    sortTo(a,tmp,lo,mid,less);
+    sortTo(a,tmp,mid,hi,less);
+    mergeInto(tmp,a,lo,mid,hi,less);
+}
+
+//sorts src[lo..hi) and moves the result into dst[lo..hi) (ping-pong , no copy back)
+template<class A,class B,class L>
+void sortTo(A src,B dst,std::ptrdiff_t lo,std::ptrdiff_t hi,L less)
+{
+    if(hi-lo<=INSERTION_CUTOFF)
+    {
+        insertionSort(src+lo,src+hi,less);
+        std::move(src+lo,src+hi,dst+lo);
+        return;
+    }
+    std::ptrdiff_t mid=lo+(hi-lo)/2;
+    sortInPlace(src,dst,lo,mid,less);
+    sortInPlace(src,dst,mid,hi,less);
+    if(!less(src[mid],src[mid-1]))
+    {
+        //halves already in order
+        std::move(src+lo,src+hi,dst+lo);
+        return;
+    }
+    mergeInto(src,dst,lo,mid,hi,less);
+}
+
+}//namespace detail
+
+template<class It,class Comp=std::less<>,class Proj=identity>
+void bubbleSort(It first,It last,Comp comp={},Proj proj={})
+{
+    detail::Less<Comp,Proj> less{comp,proj};
+    std::ptrdiff_t n=last-first;
+    for(std::ptrdiff_t i=0;i<n-1;i++)
+    {
+        bool swapped=false;
+        for(std::ptrdiff_t j=0;j<n-i-1;j++)
+        {
+            if(less(first[j+1],first[j]))
+            {
+                std::iter_swap(first+j,first+j+1);
+                swapped=true;
+            }
+        }
+        if(!swapped)
+        {
+            break;
+        }
+    }
+}
+
+template<class It,class Comp=std::less<>,class Proj=identity>
+void selectionSort(It first,It last,Comp comp={},Proj proj={})
+{
+    detail::Less<Comp,Proj> less{comp,proj};
+    for(It i=first;i!=last;++i)
+    {
+        It k=i;
+        for(It j=i+1;j!=last;++j)
+        {
+            if(less(*j,*k))
+            {
+                k=j;
+            }
+        }
+        std::iter_swap(i,k);
+    }
+}
+
+//introsort , same engine as QUICK SORT/program.cpp introSort
+template<class It,class Comp=std::less<>,class Proj=identity>
+void quickSort(It first,It last,Comp comp={},Proj proj={})
+{
+    std::ptrdiff_t n=last-first;
+    if(n<2)
+    {
+        return;
+    }
+    int depthLimit=0;
+    for(std::ptrdiff_t m=n;m>1;m>>=1)
+    {
+        depthLimit+=2;
+    }
+    detail::introSortLoop(first,last,depthLimit,detail::Less<Comp,Proj>{comp,proj});
+}
+
+//stable merge sort , one buffer per call
+template<class It,class Comp=std::less<>,class Proj=identity>
+void mergeSort(It first,It last,Comp comp={},Proj proj={})
+{
+    using T=typename std::iterator_traits<It>::value_type;
+    std::ptrdiff_t n=last-first;
+    if(n<2)
+    {
+        return;
+    }
+    //elements are moved (not copied) into the buffer , then sorted back into the range
+    std::vector<T> buf(std::make_move_iterator(first),std::make_move_iterator(last));
+    detail::sortTo(buf.begin(),first,0,n,detail::Less<Comp,Proj>{comp,proj});
+}
+
+}//namespace sorting
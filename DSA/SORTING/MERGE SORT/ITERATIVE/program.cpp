@@ -1,8 +1,27 @@
+#include "../merge_sort.h"
 
 class Solution {
   public:
     void mergeSort(vector<int>& arr, int l, int r) {
-        int n= arr.size();
+        vector<int> workspace;
+        mergeSort(arr,l,r,workspace);
+    }
+    //workspace is caller owned and only ever grows
+    //pass the same one to every call -> no allocation after the first sort
+    void mergeSort(vector<int>& arr, int l, int r, vector<int>& workspace) {
+        //only arr[l..r] is sorted , everything is indexed from l
+        int n= r-l+1;
+        if(n<2)
+        {
+            return;
+        }
+        if((int)workspace.size()<n)
+        {
+            workspace.resize(n);
+        }
+        //ping-pong : every pass reads src and writes dst , then they swap
+        int* src=arr.data()+l;
+        int* dst=workspace.data();
         int size=1;
         for(;size<n;size*=2)
         {
@@ -12,46 +31,155 @@ class Solution {
                 int high=min(left+size*2-1,n-1);
                 if(mid<high)
                 {
-                    merge(arr,left,mid,high);
+                    pingPongMerge(src,dst,left,mid,high);
+                }
+                else
+                {
+                    //lonely tail still has to move to dst
+                    copy(src+left,src+high+1,dst+left);
                 }
             }
+            swap(src,dst);
+        }
+        //odd number of passes -> result sits in workspace , one copy back
+        if(src!=arr.data()+l)
+        {
+            copy(src,src+n,arr.begin()+l);
         }
         
     }
-    void merge(vector<int>&nums,int low ,int mid , int high)
+    //cache-aware mode : natural runs + L1 blocked first merges , then global passes
+    //presorted input is one run -> zero merge passes
+    static const int MIN_RUN=32;
+    static const int L1_BLOCK=4096;//ints , block + its scratch fit in a 32KB L1
+    void cacheAwareMergeSort(vector<int>& arr, int l, int r) {
+        vector<int> workspace;
+        cacheAwareMergeSort(arr,l,r,workspace);
+    }
+    //workspace = n ints of merge scratch , then two boundary arrays (the runs , one merge level)
+    //every run but the last is at least MIN_RUN long -> at most n/MIN_RUN+2 boundaries each
+    //a reused workspace means no allocation at all , as with mergeSort
+    void cacheAwareMergeSort(vector<int>& arr, int l, int r, vector<int>& workspace) {
+        int n=r-l+1;
+        if(n<2)
+        {
+            return;
+        }
+        int maxBounds=n/MIN_RUN+2;
+        if((int)workspace.size()<n+2*maxBounds)
+        {
+            workspace.resize(n+2*maxBounds);
+        }
+        int* a=arr.data()+l;
+        int* tmp=workspace.data();
+        int* bounds=tmp+n;
+        int* level=bounds+maxBounds;
+        int runs=findRuns(a,n,bounds)-1;
+        //first pass : merge the small runs inside each L1 block while it is hot
+        //the block boundaries are written over bounds[] , never ahead of the run being read
+        int merged=1;
+        int k=0;
+        while(k<runs)
+        {
+            int start=bounds[k];
+            int end=k+1;
+            while(end<runs && bounds[end+1]-start<=L1_BLOCK)
+            {
+                end++;
+            }
+            if(end-k>1)
+            {
+                mergeAllRuns(a,tmp,bounds+k,end-k+1,level);
+            }
+            bounds[merged++]=bounds[end];
+            k=end;
+        }
+        //remaining passes over whole blocks
+        mergeAllRuns(a,tmp,bounds,merged,level);
+    }
+    //splits a[0..n) into ascending runs , writes the run boundaries to bounds (first is 0 , last is n)
+    //and returns how many there are ; strictly descending runs are reversed in place ,
+    //short runs are grown to MIN_RUN
+    int findRuns(int* a,int n,int* bounds)
     {
-        int left;
-        int right;
-        left=low;
-        right=mid+1;
-        vector<int> b;
-        while(left<=mid && right<=high)
-        {
-            if(nums[left]<=nums[right])
+        int count=0;
+        bounds[count++]=0;
+        int start=0;
+        while(start<n)
+        {
+            int end=start+1;
+            if(end<n && a[end]<a[start])
+            {
+                //strictly descending , so reversing keeps it stable
+                while(end<n && a[end]<a[end-1])
+                {
+                    end++;
+                }
+                reverse(a+start,a+end);
+            }
+            else
             {
-                b.push_back(nums[left]);
-                left++;
+                while(end<n && a[end]>=a[end-1])
+                {
+                    end++;
+                }
             }
-            else if(nums[left]>nums[right])
+            if(end-start<MIN_RUN && end<n)
             {
-                b.push_back(nums[right]);
-                right++;
+                int target=min(start+MIN_RUN,n);
+                for(;end<target;end++)
+                {
+                    int key=a[end];
+                    int j=end-1;
+                    while(j>=start && a[j]>key)
+                    {
+                        a[j+1]=a[j];
+                        j--;
+                    }
+                    a[j+1]=key;
+                }
             }
+            bounds[count++]=end;
+            start=end;
         }
-        for(;left<=mid;left++)
+        return count;
+    }
+    //merges neighbouring runs pass by pass (ping-pong) until one is left , result ends in a
+    //bounds[0..count) is only read ; each pass compacts its boundaries in place in level
+    void mergeAllRuns(int* a,int* tmp,const int* bounds,int count,int* level)
+    {
+        int first=bounds[0];
+        int last=bounds[count-1];
+        if(count<=2)
         {
-            b.push_back(nums[left]);
-            
+            return;
         }
-        for(;right<=high;right++)
+        copy(bounds,bounds+count,level);
+        int* src=a;
+        int* dst=tmp;
+        while(count>2)
         {
-            b.push_back(nums[right]);
+            int runs=count-1;
+            int next=1;
+            for(int k=0;k<runs;k+=2)
+            {
+                if(k+1<runs)
+                {
+                    pingPongMerge(src,dst,level[k],level[k+1]-1,level[k+2]-1);
+                    level[next++]=level[k+2];
+                }
+                else
+                {
+                    copy(src+level[k],src+level[k+1],dst+level[k]);
+                    level[next++]=level[k+1];
+                }
+            }
+            swap(src,dst);
+            count=next;
         }
-        for(int i=0;i<b.size();i++)
+        if(src!=a)
         {
-            nums[low+i]=b[i];
+            copy(src+first,src+last,a+first);
         }
-
-
     }
 };
@@ -0,0 +1,57 @@
+#include<bits/stdc++.h>
+using namespace std;
+#include "program.cpp"
+
+//scaling benchmark : serial mergeSort once , then parallelMergeSort at 1 , 2 , 4 ... maxThreads
+//every run sorts the same random input with a warm workspace and must equal the serial result
+int bench(long long n,int maxThreads,int reps)
+{
+    mt19937 rng(2024);
+    vector<int> input(n);
+    for(auto& x:input)
+    {
+        x=(int)rng();
+    }
+    Solution sol;
+    vector<int> nums;
+    vector<int> workspace(n);
+    //best of reps , the input is copied back outside the timed part
+    auto timeIt=[&](auto sortOnce)
+    {
+        double best=1e30;
+        for(int r=0;r<reps;r++)
+        {
+            nums=input;
+            auto start=chrono::steady_clock::now();
+            sortOnce();
+            best=min(best,chrono::duration<double,milli>(chrono::steady_clock::now()-start).count());
+        }
+        return best;
+    };
+    double serial=timeIt([&]{ sol.mergeSort(nums,workspace); });
+    vector<int> expect=nums;
+    cout<<n<<" ints , best of "<<reps<<" , hardware threads : "<<thread::hardware_concurrency()<<endl;
+    cout<<"  mergeSort               "<<fixed<<setprecision(0)<<setw(7)<<serial<<" ms"<<endl;
+    bool ok=true;
+    for(int t=1;t<=maxThreads;t*=2)
+    {
+        double ms=timeIt([&]{ sol.parallelMergeSort(nums,workspace,t); });
+        bool same= nums==expect;
+        ok=ok && same;
+        cout<<"  parallel , threads "<<setw(3)<<t<<" "<<setw(7)<<ms<<" ms   speedup "
+            <<setprecision(2)<<serial/ms<<setprecision(0)<<(same ? "" : "   WRONG RESULT")<<endl;
+    }
+    return ok ? 0 : 1;
+}
+
+int main(int argc,char** argv) {
+    long long n= argc>=2 ? stoll(argv[1]) : 100000000;
+    int maxThreads= argc>=3 ? stoi(argv[2]) : (int)max(1u,thread::hardware_concurrency());
+    int reps= argc>=4 ? stoi(argv[3]) : 3;
+    if(n<1 || n>INT_MAX || maxThreads<1 || reps<1)
+    {
+        cerr<<"usage: "<<argv[0]<<" [n=100000000] [max threads=hardware] [reps=3]"<<endl;
+        return 1;
+    }
+    return bench(n,maxThreads,reps);
+}
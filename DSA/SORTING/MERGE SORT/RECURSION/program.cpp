@@ -1,55 +1,112 @@
+#include "../merge_sort.h"
+
 class Solution {
 public:
     vector<int> mergeSort(vector<int>& nums) {
-        int n=nums.size();
-        mergeSortHelper(nums,0,n-1);
+        vector<int> workspace;
+        mergeSort(nums,workspace);
         return nums;
     }
-    void mergeSortHelper(vector<int>&nums,int low , int high)
+    //workspace is caller owned and only ever grows
+    //pass the same one to every call -> no allocation after the first sort
+    //ping-pong recursion with sorting-network leaves : merge_sort.h
+    void mergeSort(vector<int>& nums,vector<int>& workspace)
+    {
+        pingPongMergeSort(nums,workspace);
+    }
+
+    //parallel mode : same ping-pong recursion , halves forked as tasks
+    //output is exactly what the serial mergeSort produces (the merge is stable)
+    static const int PARALLEL_SORT_CUTOFF=1<<14;
+    static const int PARALLEL_MERGE_CUTOFF=1<<15;
+    vector<int> parallelMergeSort(vector<int>& nums,int threads)
+    {
+        vector<int> workspace;
+        parallelMergeSort(nums,workspace,threads);
+        return nums;
+    }
+    void parallelMergeSort(vector<int>& nums,vector<int>& workspace,int threads)
+    {
+        int n=nums.size();
+        if(n<2)
+        {
+            return;
+        }
+        if((int)workspace.size()<n)
+        {
+            workspace.resize(n);
+        }
+        copy(nums.begin(),nums.end(),workspace.begin());
+        parallelMergeSortHelper(workspace.data(),nums.data(),0,n-1,max(threads,1));
+    }
+    void parallelMergeSortHelper(int* src,int* dst,int low,int high,int threads)
     {
-        if(low>=high)
+        if(threads<=1 || high-low+1<PARALLEL_SORT_CUTOFF)
         {
+            pingPongMergeSort(src,dst,low,high);
             return;
         }
         int mid=(low+high)/2;
-        mergeSortHelper(nums,low,mid);
-        mergeSortHelper(nums,mid+1,high);
-        merge(nums,low,mid,high);
+        //left half on a new task , right half on this thread
+        auto leftTask=async(launch::async,[=]
+        {
+            parallelMergeSortHelper(dst,src,low,mid,threads/2);
+        });
+        parallelMergeSortHelper(dst,src,mid+1,high,threads-threads/2);
+        leftTask.get();
+        if(src[mid]<=src[mid+1])
+        {
+            copy(src+low,src+high+1,dst+low);
+            return;
+        }
+        parallelMerge(src+low,mid-low+1,src+mid+1,high-mid,dst+low,threads);
     }
-    void merge(vector<int>&nums,int low ,int mid , int high)
+    //merges a[0..na) and b[0..nb) into out
+    //split the bigger run at its median , binary search the split point in the other one ,
+    //then both pieces merge independently
+    void parallelMerge(const int* a,int na,const int* b,int nb,int* out,int threads)
     {
-        int left;
-        int right;
-        left=low;
-        right=mid+1;
-        vector<int> b;
-        while(left<=mid && right<=high)
-        {
-            if(nums[left]<=nums[right])
-            {
-                b.push_back(nums[left]);
-                left++;
-            }
-            else if(nums[left]>nums[right])
-            {
-                b.push_back(nums[right]);
-                right++;
-            }
+        if(threads<=1 || na+nb<PARALLEL_MERGE_CUTOFF)
+        {
+            mergeRuns(a,na,b,nb,out);
+            return;
         }
-        for(;left<=mid;left++)
+        int i,j;
+        if(na>=nb)
         {
-            b.push_back(nums[left]);
-            
+            i=na/2;
+            //b values equal to a[i] must stay after it (stability)
+            j=lower_bound(b,b+nb,a[i])-b;
         }
-        for(;right<=high;right++)
+        else
         {
-            b.push_back(nums[right]);
+            j=nb/2;
+            //a values equal to b[j] must stay before it (stability)
+            i=upper_bound(a,a+na,b[j])-a;
         }
-        for(int i=0;i<b.size();i++)
+        auto leftTask=async(launch::async,[=]
         {
-            nums[low+i]=b[i];
+            parallelMerge(a,i,b,j,out,threads/2);
+        });
+        parallelMerge(a+i,na-i,b+j,nb-j,out+i+j,threads-threads/2);
+        leftTask.get();
+    }
+    void mergeRuns(const int* a,int na,const int* b,int nb,int* out)
+    {
+        int left=0;
+        int right=0;
+        while(left<na && right<nb)
+        {
+            if(a[left]<=b[right])
+            {
+                *out++=a[left++];
+            }
+            else
+            {
+                *out++=b[right++];
+            }
         }
-
-
+        out=copy(a+left,a+na,out);
+        copy(b+right,b+nb,out);
     }
 };
@@ -0,0 +1,73 @@
+//allocation-free ping-pong merge sort on ints , shared by MERGE SORT (RECURSION , ITERATIVE)
+//and EXTERNAL SORT (its in-memory runs)
+//the caller owns the workspace : same one every call -> no allocation after the first sort
+#pragma once
+#include "../SORTING NETWORK/network.h"
+#include<algorithm>
+#include<vector>
+
+//merges src[low..mid] and src[mid+1..high] into dst[low..high] , no copy back , stable
+static inline void pingPongMerge(const int* src,int* dst,int low,int mid,int high)
+{
+    if(src[mid]<=src[mid+1])
+    {
+        //already in order , nothing to merge
+        std::copy(src+low,src+high+1,dst+low);
+        return;
+    }
+    int left=low;
+    int right=mid+1;
+    int k=low;
+    while(left<=mid && right<=high)
+    {
+        if(src[left]<=src[right])
+        {
+            dst[k++]=src[left++];
+        }
+        else
+        {
+            dst[k++]=src[right++];
+        }
+    }
+    for(;left<=mid;left++)
+    {
+        dst[k++]=src[left];
+    }
+    for(;right<=high;right++)
+    {
+        dst[k++]=src[right];
+    }
+}
+
+//src and dst hold the same values on entry ,
+//on exit dst[low..high] is sorted (src is used as scratch)
+static inline void pingPongMergeSort(int* src,int* dst,int low,int high)
+{
+    if(high-low+1<=SMALL_SORT_MAX)
+    {
+        //leaf : sorting network straight in dst (same values as src)
+        sortSmall(dst+low,high-low+1);
+        return;
+    }
+    int mid=(low+high)/2;
+    //roles swap each level , so the sorted halves land in src
+    pingPongMergeSort(dst,src,low,mid);
+    pingPongMergeSort(dst,src,mid+1,high);
+    pingPongMerge(src,dst,low,mid,high);
+}
+
+//sorts nums , workspace only ever grows
+static inline void pingPongMergeSort(std::vector<int>& nums,std::vector<int>& workspace)
+{
+    int n=nums.size();
+    if(n<2)
+    {
+        return;
+    }
+    if((int)workspace.size()<n)
+    {
+        workspace.resize(n);
+    }
+    std::copy(nums.begin(),nums.end(),workspace.begin());
+    pingPongMergeSort(workspace.data(),nums.data(),0,n-1);
+}
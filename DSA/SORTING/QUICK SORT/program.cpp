@@ -1,9 +1,214 @@
+#include<immintrin.h>
+#include<algorithm>
+#include<climits>
+#include<cstring>
+#include<functional>
+#include<queue>
+#include<utility>
+#include<vector>
+#include "../SORTING NETWORK/network.h"
+
+//partition kernels for fastSort : rearrange a[0..n) so every x < bound comes first , return how many
+//no pivot placement , no branch on the comparison result
+
+//BlockQuicksort : record misplaced offsets of a block first (branch free) , then swap them in bulk
+static const int PARTITION_BLOCK=128;
+static int blockPartitionBelow(int* a,int n,int bound)
+{
+    int offL[PARTITION_BLOCK];
+    int offR[PARTITION_BLOCK];
+    int l=0;
+    int r=n;
+    int numL=0,numR=0,startL=0,startR=0;
+    while(r-l>2*PARTITION_BLOCK)
+    {
+        if(numL==0)
+        {
+            startL=0;
+            for(int i=0;i<PARTITION_BLOCK;i++)
+            {
+                offL[numL]=i;
+                numL+=!(a[l+i]<bound);
+            }
+        }
+        if(numR==0)
+        {
+            startR=0;
+            for(int i=0;i<PARTITION_BLOCK;i++)
+            {
+                offR[numR]=i;
+                numR+=(a[r-1-i]<bound);
+            }
+        }
+        int num=std::min(numL,numR);
+        for(int j=0;j<num;j++)
+        {
+            std::swap(a[l+offL[startL+j]],a[r-1-offR[startR+j]]);
+        }
+        numL-=num;
+        numR-=num;
+        startL+=num;
+        startR+=num;
+        if(numL==0)
+        {
+            l+=PARTITION_BLOCK;
+        }
+        if(numR==0)
+        {
+            r-=PARTITION_BLOCK;
+        }
+    }
+    //a[0..l) < bound , a[r..n) >= bound , finish the middle the classic way
+    int i=l;
+    int j=r-1;
+    while(true)
+    {
+        while(i<=j && a[i]<bound) i++;
+        while(i<=j && a[j]>=bound) j--;
+        if(i>=j) break;
+        std::swap(a[i],a[j]);
+        i++;
+        j--;
+    }
+    return i;
+}
+
+//for every 8-bit mask : lane order that puts the set lanes first , then the others
+struct CompressTable {
+    alignas(32) int perm[256][8];
+    CompressTable()
+    {
+        for(int m=0;m<256;m++)
+        {
+            int k=0;
+            for(int i=0;i<8;i++) if(m>>i&1) perm[m][k++]=i;
+            for(int i=0;i<8;i++) if(!(m>>i&1)) perm[m][k++]=i;
+        }
+    }
+};
+static const CompressTable compressTable;
+
+//in-place vector partition : two vectors are held in registers so there is always 8 lanes
+//of free space at the side being written , every full store is safe
+__attribute__((target("avx2")))
+static int avx2PartitionBelow(int* a,int n,int bound)
+{
+    if(n<32)
+    {
+        return blockPartitionBelow(a,n,bound);
+    }
+    __m256i b=_mm256_set1_epi32(bound);
+    __m256i vl=_mm256_loadu_si256((__m256i*)a);
+    __m256i vr=_mm256_loadu_si256((__m256i*)(a+n-8));
+    int readL=8,readR=n-8,wl=0,wr=n;
+    while(readR-readL>=8)
+    {
+        //read from the side with less free space
+        __m256i v;
+        if(readL-wl<=wr-readR)
+        {
+            v=_mm256_loadu_si256((__m256i*)(a+readL));
+            readL+=8;
+        }
+        else
+        {
+            readR-=8;
+            v=_mm256_loadu_si256((__m256i*)(a+readR));
+        }
+        //lanes < bound first , the rest after , then one full store at each end
+        int m=_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(b,v)));
+        int cnt=__builtin_popcount(m);
+        __m256i p=_mm256_permutevar8x32_epi32(v,_mm256_load_si256((const __m256i*)compressTable.perm[m]));
+        _mm256_storeu_si256((__m256i*)(a+wl),p);
+        _mm256_storeu_si256((__m256i*)(a+wr-8),p);
+        wl+=cnt;
+        wr-=8-cnt;
+    }
+    //leftovers + the two held vectors : exactly wr-wl slots are free now
+    int tmp[24];
+    int rem=readR-readL;
+    std::memcpy(tmp,a+readL,rem*sizeof(int));
+    _mm256_storeu_si256((__m256i*)(tmp+rem),vl);
+    _mm256_storeu_si256((__m256i*)(tmp+rem+8),vr);
+    for(int i=0;i<rem+16;i++)
+    {
+        int x=tmp[i];
+        int less=x<bound;
+        int at=less ? wl : wr-1;
+        a[at]=x;
+        wl+=less;
+        wr-=!less;
+    }
+    return wl;
+}
+
+//same loop , but AVX-512 has a real compress-store so nothing is written past the count
+__attribute__((target("avx512f")))
+static int avx512PartitionBelow(int* a,int n,int bound)
+{
+    if(n<64)
+    {
+        return blockPartitionBelow(a,n,bound);
+    }
+    __m512i b=_mm512_set1_epi32(bound);
+    __m512i vl=_mm512_loadu_si512(a);
+    __m512i vr=_mm512_loadu_si512(a+n-16);
+    int readL=16,readR=n-16,wl=0,wr=n;
+    while(readR-readL>=16)
+    {
+        __m512i v;
+        if(readL-wl<=wr-readR)
+        {
+            v=_mm512_loadu_si512(a+readL);
+            readL+=16;
+        }
+        else
+        {
+            readR-=16;
+            v=_mm512_loadu_si512(a+readR);
+        }
+        __mmask16 m=_mm512_cmplt_epi32_mask(v,b);
+        int cnt=__builtin_popcount(m);
+        _mm512_mask_compressstoreu_epi32(a+wl,m,v);
+        _mm512_mask_compressstoreu_epi32(a+wr-(16-cnt),(__mmask16)~m,v);
+        wl+=cnt;
+        wr-=16-cnt;
+    }
+    int tmp[48];
+    int rem=readR-readL;
+    std::memcpy(tmp,a+readL,rem*sizeof(int));
+    _mm512_storeu_si512(tmp+rem,vl);
+    _mm512_storeu_si512(tmp+rem+16,vr);
+    for(int i=0;i<rem+32;i++)
+    {
+        int x=tmp[i];
+        int less=x<bound;
+        int at=less ? wl : wr-1;
+        a[at]=x;
+        wl+=less;
+        wr-=!less;
+    }
+    return wl;
+}
+
+//picked once at startup from what the cpu supports
+typedef int (*PartitionKernel)(int*,int,int);
+static PartitionKernel pickPartitionKernel()
+{
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")) return avx512PartitionBelow;
+    if(__builtin_cpu_supports("avx2")) return avx2PartitionBelow;
+    return blockPartitionBelow;
+}
+static const PartitionKernel partitionBelow=pickPartitionKernel();
+
 class Solution {
 public:
     void quickSortHelper(vector<int>& nums,int low, int high)
     {
-        if(low>=high)//base case
+        if(high-low+1<=SMALL_SORT_MAX)//base case : 0..16 elements go to a sorting network
         {
+            sortSmall(nums.data()+low,high-low+1);
             return;
         }
         int pivot = partition(nums,low,high);
@@ -42,4 +247,311 @@ public:
         return right;
     }
 
+    //introsort : production mode of quickSort
+    //good pivot + smaller side recursion + heapsort fallback + insertion sort leaves
+    static const int INSERTION_CUTOFF=16;
+    vector<int> introSort(vector<int>& nums)
+    {
+        int n=nums.size();
+        if(n<2)
+        {
+            return nums;
+        }
+        int depthLimit=2*__lg(n);
+        introSortHelper(nums,0,n-1,depthLimit);
+        return nums;
+    }
+    void introSortHelper(vector<int>& nums,int low,int high,int depthLimit)
+    {
+        while(high-low+1>INSERTION_CUTOFF)
+        {
+            if(depthLimit==0)
+            {
+                //too many bad splits , heapsort keeps it O(n log n)
+                heapSort(nums,low,high);
+                return;
+            }
+            depthLimit--;
+            choosePivot(nums,low,high);
+            int pivot=balancedPartition(nums,low,high);
+            //recurse on the smaller side , loop on the bigger one
+            //so the stack never goes deeper than log n
+            if(pivot-low<high-pivot)
+            {
+                introSortHelper(nums,low,pivot-1,depthLimit);
+                low=pivot+1;
+            }
+            else
+            {
+                introSortHelper(nums,pivot+1,high,depthLimit);
+                high=pivot-1;
+            }
+        }
+        insertionSort(nums,low,high);
+    }
+    int medianOfThree(vector<int>& nums,int a,int b,int c)
+    {
+        if(nums[a]<nums[b])
+        {
+            if(nums[b]<nums[c]) return b;
+            return nums[a]<nums[c] ? c : a;
+        }
+        if(nums[a]<nums[c]) return a;
+        return nums[b]<nums[c] ? c : b;
+    }
+    //moves the chosen pivot to nums[low] so partition can stay the same shape
+    void choosePivot(vector<int>& nums,int low,int high)
+    {
+        int n=high-low+1;
+        int mid=low+(high-low)/2;
+        int m;
+        if(n>128)
+        {
+            //ninther : median of three medians
+            int s=n/8;
+            int m1=medianOfThree(nums,low,low+s,low+2*s);
+            int m2=medianOfThree(nums,mid-s,mid,mid+s);
+            int m3=medianOfThree(nums,high-2*s,high-s,high);
+            m=medianOfThree(nums,m1,m2,m3);
+        }
+        else
+        {
+            m=medianOfThree(nums,low,mid,high);
+        }
+        swap(nums[low],nums[m]);
+    }
+    //same as partition but both pointers stop on equal keys
+    //so all-equal input splits in the middle instead of at low
+    int balancedPartition(vector<int>& nums,int low,int high)
+    {
+        int pivot=nums[low];
+        int left=low+1;
+        int right=high;
+        while(true)
+        {
+            while(left<=right && nums[left]<pivot)
+            {
+                left++;
+            }
+            while(left<=right && nums[right]>pivot)
+            {
+                right--;
+            }
+            if(left>=right)
+            {
+                break;
+            }
+            swap(nums[left],nums[right]);
+            left++;
+            right--;
+        }
+        swap(nums[low],nums[right]);
+        return right;
+    }
+    void insertionSort(vector<int>& nums,int low,int high)
+    {
+        for(int i=low+1;i<=high;i++)
+        {
+            int key=nums[i];
+            int j=i-1;
+            while(j>=low && nums[j]>key)
+            {
+                nums[j+1]=nums[j];
+                j--;
+            }
+            nums[j+1]=key;
+        }
+    }
+    void heapSort(vector<int>& nums,int low,int high)
+    {
+        int n=high-low+1;
+        for(int i=n/2-1;i>=0;i--)
+        {
+            siftDown(nums,low,i,n);
+        }
+        for(int end=n-1;end>0;end--)
+        {
+            swap(nums[low],nums[low+end]);
+            siftDown(nums,low,0,end);
+        }
+    }
+    //max heap stored in nums[base..base+n-1]
+    void siftDown(vector<int>& nums,int base,int i,int n)
+    {
+        int val=nums[base+i];
+        while(2*i+1<n)
+        {
+            int child=2*i+1;
+            if(child+1<n && nums[base+child]<nums[base+child+1])
+            {
+                child++;
+            }
+            if(nums[base+child]<=val)
+            {
+                break;
+            }
+            nums[base+i]=nums[base+child];
+            i=child;
+        }
+        nums[base+i]=val;
+    }
+
+    //fastSort : introsort driven by the branch free / SIMD partitionBelow kernels
+    vector<int> fastSort(vector<int>& nums)
+    {
+        int n=nums.size();
+        if(n<2)
+        {
+            return nums;
+        }
+        fastSortHelper(nums,0,n-1,2*__lg(n));
+        return nums;
+    }
+    void fastSortHelper(vector<int>& nums,int low,int high,int depthLimit)
+    {
+        while(high-low+1>INSERTION_CUTOFF)
+        {
+            if(depthLimit==0)
+            {
+                heapSort(nums,low,high);
+                return;
+            }
+            depthLimit--;
+            choosePivot(nums,low,high);
+            int pivot=nums[low];
+            int k=partitionBelow(nums.data()+low,high-low+1,pivot);
+            if(k==0)
+            {
+                //pivot is the minimum : peel off every copy of it , they are already in place
+                if(pivot==INT_MAX)
+                {
+                    return;
+                }
+                low+=partitionBelow(nums.data()+low,high-low+1,pivot+1);
+                continue;
+            }
+            //[low,low+k) < pivot <= [low+k,high] , smaller side recursive
+            int mid=low+k;
+            if(mid-low<high-mid+1)
+            {
+                fastSortHelper(nums,low,mid-1,depthLimit);
+                low=mid;
+            }
+            else
+            {
+                fastSortHelper(nums,mid,high,depthLimit);
+                high=mid-1;
+            }
+        }
+        insertionSort(nums,low,high);
+    }
+
+    //quickSelect : like nth_element , nums[k] ends up where a full sort would put it ,
+    //smaller ones before , larger ones after . returns nums[k] (k is 0-based)
+    int quickSelect(vector<int>& nums,int k)
+    {
+        int n=nums.size();
+        selectHelper(nums,0,n-1,k,2*__lg(n));
+        return nums[k];
+    }
+    //introselect : ninther pivots while they behave , median of medians once the
+    //depth budget runs out -> linear in the worst case
+    void selectHelper(vector<int>& nums,int low,int high,int k,int depthLimit)
+    {
+        while(high-low+1>INSERTION_CUTOFF)
+        {
+            if(depthLimit==0)
+            {
+                swap(nums[low],nums[medianOfMedians(nums,low,high)]);
+            }
+            else
+            {
+                depthLimit--;
+                choosePivot(nums,low,high);
+            }
+            int pivot=balancedPartition(nums,low,high);
+            if(k==pivot)
+            {
+                return;
+            }
+            if(k<pivot)
+            {
+                high=pivot-1;
+            }
+            else
+            {
+                low=pivot+1;
+            }
+        }
+        insertionSort(nums,low,high);
+    }
+    //median of the medians of groups of 5 , always splits at least 30/70
+    int medianOfMedians(vector<int>& nums,int low,int high)
+    {
+        int n=high-low+1;
+        if(n<=5)
+        {
+            insertionSort(nums,low,high);
+            return low+n/2;
+        }
+        //gather the group medians at the front
+        int m=low;
+        for(int i=low;i<=high;i+=5)
+        {
+            int end=min(i+4,high);
+            insertionSort(nums,i,end);
+            swap(nums[m++],nums[i+(end-i)/2]);
+        }
+        int mid=low+(m-low)/2;
+        selectHelper(nums,low,m-1,mid,0);
+        return mid;
+    }
+    //partialSort : the k smallest values , sorted , in nums[0..k) . the rest is in no order
+    vector<int> partialSort(vector<int>& nums,int k)
+    {
+        int n=nums.size();
+        k=min(k,n);
+        if(k<=0)
+        {
+            return nums;
+        }
+        if(k<n)
+        {
+            quickSelect(nums,k-1);
+        }
+        introSortHelper(nums,0,k-1,2*__lg(k)+2);
+        return nums;
+    }
+    //streaming top-k : the k largest values of any input range , largest first
+    //only a k sized min-heap is kept , the input is read once and never stored
+    template<class It>
+    vector<int> topK(It first,It last,int k)
+    {
+        priority_queue<int,vector<int>,greater<int>> heap;
+        if(k<=0)
+        {
+            return {};
+        }
+        for(;first!=last;++first)
+        {
+            int x=*first;
+            if((int)heap.size()<k)
+            {
+                heap.push(x);
+            }
+            else if(x>heap.top())
+            {
+                heap.pop();
+                heap.push(x);
+            }
+        }
+        vector<int> ans(heap.size());
+        for(int i=ans.size()-1;i>=0;i--)
+        {
+            ans[i]=heap.top();
+            heap.pop();
+        }
+        return ans;
+    }
+
 };
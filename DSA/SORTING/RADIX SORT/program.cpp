@@ -0,0 +1,41 @@
+#include "radix.h"
+
+class Solution {
+public:
+    //LSD radix sort , 3 passes of 11 bits (11+11+10) over 32-bit keys (kernel : radix.h)
+    //same interface as quickSort / mergeSort
+    static const int RADIX_CUTOFF=192;
+    vector<int> radixSort(vector<int>& nums) {
+        vector<int> workspace;
+        radixSort(nums,workspace);
+        return nums;
+    }
+    void radixSort(vector<int>& nums,vector<int>& workspace)
+    {
+        int n=nums.size();
+        if(n<RADIX_CUTOFF)
+        {
+            //the 3 x 2048 bucket tables cost more than a comparison sort here
+            sort(nums.begin(),nums.end());
+            return;
+        }
+        if((int)workspace.size()<n)
+        {
+            workspace.resize(n);
+        }
+        unsigned* src=(unsigned*)nums.data();
+        unsigned* dst=(unsigned*)workspace.data();
+        //the sign bit is flipped on the way so signed order == unsigned order , flipped back at the end
+        vector<unsigned> count(RADIX_PASSES*RADIX_BUCKETS,0);
+        radixHistogram(src,n,0,count.data(),[](unsigned key){ return key^0x80000000u; });
+        src=radixScatter(src,dst,n,0,count.data());
+        for(int i=0;i<n;i++)
+        {
+            src[i]^=0x80000000u;
+        }
+        if(src!=(unsigned*)nums.data())
+        {
+            copy((int*)src,(int*)src+n,nums.begin());
+        }
+    }
+};
@@ -0,0 +1,62 @@
+//LSD radix sort kernel over a 32-bit digit field of unsigned keys (uint32_t or uint64_t)
+//3 stable passes of 11 + 11 + 10 bits over bits [shift , shift+32) of every key
+//shared by RADIX SORT (plain ints) and Two Sum/OPTIMAL (value , index) words sorted by value
+#pragma once
+#include<cstddef>
+#include<utility>
+
+static const int RADIX_BITS=11;
+static const int RADIX_BUCKETS=1<<RADIX_BITS;
+static const int RADIX_PASSES=3;
+
+//one read fills the counts of every digit at once : count[p*RADIX_BUCKETS+digit] , count zeroed
+//by the caller ; prepare(key) is stored back before it is counted (e.g. a sign flip) ,
+//so no separate pass over the keys is needed
+template<class K,class F>
+void radixHistogram(K* a,size_t n,int shift,unsigned* count,F prepare)
+{
+    for(size_t i=0;i<n;i++)
+    {
+        K key=prepare(a[i]);
+        a[i]=key;
+        for(int p=0;p<RADIX_PASSES;p++)
+        {
+            count[p*RADIX_BUCKETS+((key>>(shift+p*RADIX_BITS))&(RADIX_BUCKETS-1))]++;
+        }
+    }
+}
+
+//the scatter passes , src -> dst -> src ... ; returns the buffer that holds the sorted keys
+//a pass where every key has the same digit would not move anything and is skipped
+template<class K>
+K* radixScatter(K* src,K* dst,size_t n,int shift,unsigned* count)
+{
+    if(n==0)
+    {
+        return src;
+    }
+    for(int p=0;p<RADIX_PASSES;p++)
+    {
+        unsigned* c=count+p*RADIX_BUCKETS;
+        int s=shift+p*RADIX_BITS;
+        if(c[(src[0]>>s)&(RADIX_BUCKETS-1)]==n)
+        {
+            continue;
+        }
+        //counts -> starting offsets
+        unsigned sum=0;
+        for(int b=0;b<RADIX_BUCKETS;b++)
+        {
+            unsigned t=c[b];
+            c[b]=sum;
+            sum+=t;
+        }
+        for(size_t i=0;i<n;i++)
+        {
+            K key=src[i];
+            dst[c[(key>>s)&(RADIX_BUCKETS-1)]++]=key;
+        }
+        std::swap(src,dst);
+    }
+    return src;
+}
@@ -0,0 +1,160 @@
+//compile-time sorting networks for the 2..16 element leaves of quickSort / mergeSort
+//the comparator list is Batcher's odd-even merge sort , built by constexpr code ,
+//then unrolled into straight-line min/max code -> no loop , no branch
+#pragma once
+#include<algorithm>
+#include<array>
+#include<climits>
+#include<utility>
+#include<immintrin.h>
+
+static const int SMALL_SORT_MAX=16;
+
+struct Comparator {
+    int i;
+    int j;
+    int layer;//comparators of one layer touch disjoint lanes
+};
+
+//calls f(i,j,layer) for every comparator of Batcher's network on n inputs (any n , not just 2^k)
+template<class F>
+constexpr void forEachComparator(int n,F f)
+{
+    int layer=0;
+    for(int p=1;p<n;p*=2)
+    {
+        for(int k=p;k>=1;k/=2)
+        {
+            for(int j=k%p;j+k<n;j+=2*k)
+            {
+                for(int i=0;i<k && i+j+k<n;i++)
+                {
+                    if((i+j)/(2*p)==(i+j+k)/(2*p))
+                    {
+                        f(i+j,i+j+k,layer);
+                    }
+                }
+            }
+            layer++;
+        }
+    }
+}
+
+template<int N>
+constexpr int networkSize()
+{
+    int count=0;
+    forEachComparator(N,[&](int,int,int){ count++; });
+    return count;
+}
+
+template<int N>
+constexpr std::array<Comparator,networkSize<N>()> buildNetwork()
+{
+    std::array<Comparator,networkSize<N>()> net{};
+    int k=0;
+    forEachComparator(N,[&](int i,int j,int layer){ net[k++]={i,j,layer}; });
+    return net;
+}
+
+template<int N>
+struct SortingNetwork {
+    static constexpr auto net=buildNetwork<N>();
+
+    static inline void compareExchange(int* a,int i,int j)
+    {
+        int x=a[i];
+        int y=a[j];
+        a[i]=std::min(x,y);
+        a[j]=std::max(x,y);
+    }
+    template<size_t... I>
+    static inline void run(int* a,std::index_sequence<I...>)
+    {
+        (compareExchange(a,net[I].i,net[I].j),...);
+    }
+    static inline void sort(int* a)
+    {
+        run(a,std::make_index_sequence<net.size()>());
+    }
+};
+
+//the 8-input network as SIMD layers : per layer a lane permutation (partner lane)
+//and a mask of lanes that keep the max
+struct SimdLayers8 {
+    int count=0;
+    int partner[8][8]{};
+    int takeMax[8][8]{};
+    constexpr SimdLayers8()
+    {
+        for(int l=0;l<8;l++)
+        {
+            for(int i=0;i<8;i++)
+            {
+                partner[l][i]=i;
+            }
+        }
+        forEachComparator(8,[&](int i,int j,int layer)
+        {
+            partner[layer][i]=j;
+            partner[layer][j]=i;
+            takeMax[layer][j]=-1;
+            count=layer+1;
+        });
+    }
+};
+static constexpr SimdLayers8 simdLayers8{};
+
+//up to 8 ints in one ymm register , padded with INT_MAX
+__attribute__((target("avx2")))
+static void simdSort8(int* a,int n)
+{
+    alignas(32) int buf[8]={INT_MAX,INT_MAX,INT_MAX,INT_MAX,INT_MAX,INT_MAX,INT_MAX,INT_MAX};
+    std::copy(a,a+n,buf);
+    __m256i v=_mm256_load_si256((const __m256i*)buf);
+    for(int l=0;l<simdLayers8.count;l++)
+    {
+        __m256i idx=_mm256_loadu_si256((const __m256i*)simdLayers8.partner[l]);
+        __m256i mask=_mm256_loadu_si256((const __m256i*)simdLayers8.takeMax[l]);
+        __m256i p=_mm256_permutevar8x32_epi32(v,idx);
+        v=_mm256_blendv_epi8(_mm256_min_epi32(v,p),_mm256_max_epi32(v,p),mask);
+    }
+    _mm256_store_si256((__m256i*)buf,v);
+    std::copy(buf,buf+n,a);
+}
+
+static bool detectAvx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+static const bool hasAvx2=detectAvx2();
+
+//leaf stage : sorts a[0..n) for n <= SMALL_SORT_MAX
+static inline void sortSmall(int* a,int n)
+{
+    if(n<=8 && n>=4 && hasAvx2)
+    {
+        simdSort8(a,n);
+        return;
+    }
+    switch(n)
+    {
+        case 2: SortingNetwork<2>::sort(a); break;
+        case 3: SortingNetwork<3>::sort(a); break;
+        case 4: SortingNetwork<4>::sort(a); break;
+        case 5: SortingNetwork<5>::sort(a); break;
+        case 6: SortingNetwork<6>::sort(a); break;
+        case 7: SortingNetwork<7>::sort(a); break;
+        case 8: SortingNetwork<8>::sort(a); break;
+        case 9: SortingNetwork<9>::sort(a); break;
+        case 10: SortingNetwork<10>::sort(a); break;
+        case 11: SortingNetwork<11>::sort(a); break;
+        case 12: SortingNetwork<12>::sort(a); break;
+        case 13: SortingNetwork<13>::sort(a); break;
+        case 14: SortingNetwork<14>::sort(a); break;
+        case 15: SortingNetwork<15>::sort(a); break;
+        case 16: SortingNetwork<16>::sort(a); break;
+        default: break;
+    }
+}